@@ -24,6 +24,7 @@
  *  RAJA features shown:
  *    - `forall` loop iteration template method
  *    - Atomic add
+ *    - `histogram` pattern, which bins without atomics
  *
  *  If CUDA is enabled, CUDA unified memory is used.
  */
@@ -105,6 +106,17 @@ int main(int RAJA_UNUSED_ARG(argc), char** RAJA_UNUSED_ARG(argv[]))
 
   printBins(bins, M);
 
+//----------------------------------------------------------------------------//
+
+  std::cout << "\n\n Running RAJA OMP histogram" << std::endl;
+  std::memset(bins, 0, M * sizeof(int));
+
+  // _rajaomp_histogram_start
+  RAJA::histogram<RAJA::omp_parallel_for_exec>(array, array + N, bins, M);
+  // _rajaomp_histogram_end
+
+  printBins(bins, M);
+
 #endif
 
 //----------------------------------------------------------------------------//
@@ -64,6 +64,10 @@
 #include "RAJA/policy/tbb.hpp"
 #endif
 
+#if defined(RAJA_ENABLE_THREADS)
+#include "RAJA/policy/threads.hpp"
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
 #include "RAJA/policy/cuda.hpp"
 #endif
@@ -80,7 +84,13 @@
 #endif
 #endif
 
+//
+// Host policy selected at run time
+//
+#include "RAJA/policy/RuntimePolicy.hpp"
+
 #include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/PrefetchListSegment.hpp"
 
 //
 // Strongly typed index class
@@ -94,8 +104,12 @@
 //
 #include "RAJA/pattern/forall.hpp"
 #include "RAJA/pattern/region.hpp"
+#include "RAJA/pattern/WorkGroup.hpp"
 
+#include "RAJA/policy/AutotunePolicy.hpp"
 #include "RAJA/policy/MultiPolicy.hpp"
+#include "RAJA/policy/StreamingPolicy.hpp"
+#include "RAJA/policy/PrefetchPolicy.hpp"
 
 
 //
@@ -156,4 +170,12 @@
 
 #include "RAJA/pattern/scan.hpp"
 
+#include "RAJA/pattern/sort.hpp"
+
+#include "RAJA/pattern/compact.hpp"
+
+#include "RAJA/pattern/histogram.hpp"
+
+#include "RAJA/pattern/transform_reduce.hpp"
+
 #endif  // closing endif for header file include guard
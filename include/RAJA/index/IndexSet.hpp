@@ -20,9 +20,13 @@
 
 #include "RAJA/config.hpp"
 
+#include <memory>
+#include <vector>
+
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
+#include "RAJA/internal/DepGraphNode.hpp"
 #include "RAJA/internal/Iterators.hpp"
 #include "RAJA/internal/RAJAVec.hpp"
 
@@ -609,6 +613,7 @@ public:
     segment_offsets = c.segment_offsets;
     segment_icounts = c.segment_icounts;
     m_len = c.m_len;
+    m_dep_graph = c.m_dep_graph;
   }
 
   //! Swap function for copy-and-swap idiom (deep copy).
@@ -619,6 +624,7 @@ public:
     swap(segment_offsets, other.segment_offsets);
     swap(segment_icounts, other.segment_icounts);
     swap(m_len, other.m_len);
+    swap(m_dep_graph, other.m_dep_graph);
   }
 
 protected:
@@ -741,6 +747,50 @@ public:
   //! Return the number of elements in the range.
   Index_type size() const { return getNumSegments(); }
 
+  ///
+  /// Segment dependency graph, used by the omp_taskgraph segment iteration
+  /// policies to run each segment as soon as the segments it depends on
+  /// have completed.
+  ///
+
+  //! Create a dependency graph with no edges over the current segments.
+  void initDependencyGraph()
+  {
+    m_dep_graph =
+        std::make_shared<std::vector<DepGraphNode>>(segment_types.size());
+  }
+
+  //! Declare that segment after may not start until segment before is done.
+  //! Segments added since the last dependency get nodes with no edges; the
+  //! edges declared so far are kept.
+  void addSegmentDependency(int before, int after)
+  {
+    if (!m_dep_graph) {
+      initDependencyGraph();
+    } else if (m_dep_graph.use_count() > 1) {
+      // copies of this index set share the graph until one changes it
+      m_dep_graph = std::make_shared<std::vector<DepGraphNode>>(*m_dep_graph);
+    }
+    m_dep_graph->resize(segment_types.size());
+    (*m_dep_graph)[before].addDepTask(after);
+    DepGraphNode& node = (*m_dep_graph)[after];
+    ++node.semaphoreReloadValue();
+    node.reset();
+  }
+
+  //! Return true if the dependency graph covers every segment.
+  bool dependencyGraphSet() const
+  {
+    return m_dep_graph && !m_dep_graph->empty() &&
+           m_dep_graph->size() == segment_types.size();
+  }
+
+  //! Return the dependency graph node of segment segid.
+  DepGraphNode &getDepGraphNode(int segid) const
+  {
+    return (*m_dep_graph)[segid];
+  }
+
 private:
   //! Vector of segment types:    seg_index -> seg_type
   RAJA::RAJAVec<Index_type> segment_types;
@@ -754,6 +804,11 @@ private:
 
   //! Total length of all TypedIndexSet segments.
   Index_type m_len;
+
+  //! Dependency graph node of each segment, shared by copies of the index
+  //! set so that copying it does not copy the graph; the semaphores are
+  //! updated during execution, also through const index sets
+  std::shared_ptr<std::vector<DepGraphNode>> m_dep_graph;
 };
 
 
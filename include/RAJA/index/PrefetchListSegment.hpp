@@ -0,0 +1,135 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining PrefetchListSegment, a list segment view
+ *          that carries the arrays its loop body gathers from.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PrefetchListSegment_HPP
+#define RAJA_PrefetchListSegment_HPP
+
+#include "RAJA/config.hpp"
+
+#include "camp/camp.hpp"
+#include "camp/tuple.hpp"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+#include "RAJA/index/IndexValue.hpp"
+#include "RAJA/index/ListSegment.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+//! Hint that the cache line holding addr will be read soon
+RAJA_INLINE void prefetch_read(const void* addr)
+{
+#if defined(__GNUC__) && !defined(__CUDA_ARCH__) \
+    && !defined(__HIP_DEVICE_COMPILE__)
+  __builtin_prefetch(addr, 0, 3);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  _mm_prefetch(static_cast<const char*>(addr), _MM_HINT_T0);
+#else
+  RAJA_UNUSED_VAR(addr);
+#endif
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Indices of a list segment together with the arrays a loop over
+ *         them gathers from.
+ *
+ *         Iterating a PrefetchListSegment visits the indices of the list, so
+ *         any policy can execute it.  With prefetch_exec the gather targets
+ *         are prefetched ahead of use: while position p runs, the elements
+ *         target[idx[p + Distance]] of every target are requested.
+ *
+ *         The segment refers to the index array of the list it was made
+ *         from, which must outlive it.  Build one with
+ *         make_prefetch_segment.
+ *
+ ******************************************************************************
+ */
+template <typename T, typename... Targets>
+class PrefetchListSegment
+{
+public:
+  using value_type = T;
+  using iterator = const T*;
+  using IndexType = Index_type;
+
+  PrefetchListSegment(const TypedListSegment<T>& list,
+                      const Targets*... targets)
+      : m_indices(list.begin()), m_size(list.size()), m_targets(targets...)
+  {
+  }
+
+  RAJA_HOST_DEVICE iterator begin() const { return m_indices; }
+
+  RAJA_HOST_DEVICE iterator end() const { return m_indices + m_size; }
+
+  RAJA_HOST_DEVICE Index_type size() const { return m_size; }
+
+  //! Prefetch the elements that the iteration at position pos reads
+  RAJA_INLINE void prefetch(Index_type pos) const
+  {
+    prefetchTargets(pos, camp::make_idx_seq_t<sizeof...(Targets)>{});
+  }
+
+private:
+  template <camp::idx_t... Is>
+  RAJA_INLINE void prefetchTargets(Index_type pos, camp::idx_seq<Is...>) const
+  {
+    const auto idx = stripIndexType(m_indices[pos]);
+    int unused[] = {0, (prefetch_read(camp::get<Is>(m_targets) + idx), 0)...};
+    RAJA_UNUSED_VAR(unused);
+  }
+
+  const T* m_indices;
+  Index_type m_size;
+  camp::tuple<const Targets*...> m_targets;
+};
+
+/*!
+ * \brief Make a PrefetchListSegment over the indices of list that gathers
+ *        from targets.
+ *
+ * Usage example:
+ *
+ * \verbatim
+ *
+ *   RAJA::TypedListSegment<int> cells(cell_list, num_cells, res);
+ *   RAJA::forall<RAJA::prefetch_exec<RAJA::omp_parallel_for_exec>>(
+ *       RAJA::make_prefetch_segment(cells, x, y),
+ *       [=](int c) { z[c] = x[c] * y[c]; });
+ *
+ * \endverbatim
+ */
+template <typename T, typename... Targets>
+PrefetchListSegment<T, Targets...> make_prefetch_segment(
+    const TypedListSegment<T>& list,
+    const Targets*... targets)
+{
+  return PrefetchListSegment<T, Targets...>(list, targets...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
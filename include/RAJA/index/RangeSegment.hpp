@@ -430,6 +430,20 @@ struct common_type<T> {
 template <typename... Ts>
 using common_type_t = typename common_type<Ts...>::type;
 
+//! Sub-range of iterations [first, last) of seg, counted from its start
+template <typename StorageT, typename DiffT>
+RAJA_HOST_DEVICE RAJA_INLINE TypedRangeSegment<StorageT, DiffT> range_chunk(
+    TypedRangeSegment<StorageT, DiffT> const& seg,
+    DiffT first,
+    DiffT last)
+{
+  using StripStorageT = strip_index_type_t<StorageT>;
+  const StripStorageT begin = stripIndexType(*seg.begin());
+  return TypedRangeSegment<StorageT, DiffT>(
+      static_cast<StripStorageT>(begin + first),
+      static_cast<StripStorageT>(begin + last));
+}
+
 }  // namespace detail
 
 //! make function for TypedRangeSegment
@@ -25,6 +25,7 @@
 #include <cstdlib>
 #include <iosfwd>
 #include <thread>
+#include <vector>
 
 #include "RAJA/util/types.hpp"
 
@@ -37,27 +38,37 @@ namespace RAJA
  * \brief  Class defining a simple semephore-based data structure for
  *         managing a node in a dependency graph.
  *
+ *         The semaphore counts the dependencies of the node that have not
+ *         been satisfied in the current traversal of the graph.  It is
+ *         updated with atomic read-modify-write operations, so any number of
+ *         threads may satisfy dependencies concurrently.
+ *
  ******************************************************************************
  */
-class RAJA_ALIGNED_ATTR(256) DepGraphNode
+class DepGraphNode
 {
 public:
   ///
-  /// Constants for total number of allowable dependent tasks
-  /// and alignment of semaphore value (should match cache
-  /// coherence page size?).
-  ///
-  /// These values may need to be set differently for different
-  /// algorithms and platforms. We haven't determined the best defaults yet!
+  /// Default ctor initializes node to default state.
   ///
-  static const int _MaxDepTasks_ = 8;
+  DepGraphNode() : m_semaphore_reload_value(0), m_semaphore_value(0) {}
 
   ///
-  /// Default ctor initializes node to default state.
+  /// Copy ctor; copies the graph edges and the current semaphore value.
   ///
-  DepGraphNode()
-      : m_num_dep_tasks(0), m_semaphore_reload_value(0), m_semaphore_value(0)
+  DepGraphNode(const DepGraphNode& other)
+      : m_dep_task(other.m_dep_task),
+        m_semaphore_reload_value(other.m_semaphore_reload_value),
+        m_semaphore_value(other.m_semaphore_value.load())
+  {
+  }
+
+  DepGraphNode& operator=(const DepGraphNode& other)
   {
+    m_dep_task = other.m_dep_task;
+    m_semaphore_reload_value = other.m_semaphore_reload_value;
+    m_semaphore_value.store(other.m_semaphore_value.load());
+    return *this;
   }
 
   ///
@@ -75,24 +86,37 @@ public:
   ///
   /// Ready this task to be used again
   ///
-  void reset() { m_semaphore_value.store(m_semaphore_reload_value); }
+  void reset()
+  {
+    m_semaphore_value.store(m_semaphore_reload_value,
+                            std::memory_order_relaxed);
+  }
 
   ///
-  /// Satisfy one incoming dependency
+  /// Satisfy one incoming dependency.
+  ///
+  /// Returns true for exactly one caller: the one satisfying the last
+  /// outstanding dependency, after which the task may execute.
   ///
-  void satisfyOne()
+  bool satisfyOne()
   {
-    if (m_semaphore_value > 0) {
-      --m_semaphore_value;
-    }
+    return m_semaphore_value.fetch_sub(1, std::memory_order_acq_rel) == 1;
+  }
+
+  ///
+  /// Return true if all dependencies have been satisfied
+  ///
+  bool ready() const
+  {
+    return m_semaphore_value.load(std::memory_order_acquire) <= 0;
   }
 
   ///
   /// Wait for all dependencies to be satisfied
   ///
-  void wait()
+  void wait() const
   {
-    while (m_semaphore_value > 0) {
+    while (!ready()) {
       // TODO: an efficient wait would be better here, but the standard
       // promise/future is not good enough
       std::this_thread::yield();
@@ -100,17 +124,24 @@ public:
   }
 
   ///
-  /// Get/set the number of "forward-dependencies" for this task; i.e., the
+  /// Get the number of "forward-dependencies" for this task; i.e., the
   /// number of external tasks that cannot execute until this task completes.
   ///
-  int& numDepTasks() { return m_num_dep_tasks; }
+  int numDepTasks() const { return static_cast<int>(m_dep_task.size()); }
 
   ///
-  /// Get/set the forward dependency task number associated with the given
+  /// Get the forward dependency task number associated with the given
   /// index for this task. This is used to notify the appropriate external
   /// dependencies when this task completes.
   ///
-  int& depTaskNum(int tidx) { return m_dep_task[tidx]; }
+  int depTaskNum(int tidx) const { return m_dep_task[tidx]; }
+
+  ///
+  /// Add a forward dependency; i.e., task number tnum cannot execute until
+  /// this task completes.  The caller is responsible for incrementing the
+  /// reload value of task tnum.
+  ///
+  void addDepTask(int tnum) { m_dep_task.push_back(tnum); }
 
   ///
   /// Print task graph object node data to given output stream.
@@ -118,8 +149,7 @@ public:
   void print(std::ostream& os) const;
 
 private:
-  int m_dep_task[_MaxDepTasks_];
-  int m_num_dep_tasks;
+  std::vector<int> m_dep_task;
   int m_semaphore_reload_value;
   std::atomic<int> m_semaphore_value;
 };
@@ -0,0 +1,305 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the WorkGroup class, which batches many
+ *          small loops into a single dispatch.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_WorkGroup_HPP
+#define RAJA_pattern_WorkGroup_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/util/align.hpp"
+#include "RAJA/util/basic_mempool.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/plugins.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Type-erased loop stored in a WorkGroup.
+ *
+ * The loop's iterations are numbered offset .. offset+length-1 in the
+ * iteration space of the whole group.
+ */
+struct WorkGroupEntry {
+  using call_type = void (*)(const void*, Index_type, Index_type);
+  using destroy_type = void (*)(void*);
+
+  void* obj;
+  call_type call;
+  destroy_type destroy;
+  Index_type offset;
+  Index_type length;
+};
+
+//! Segment and loop body of an enqueued loop
+template <typename Segment, typename Body>
+struct WorkGroupLoop {
+  Segment segment;
+  Body body;
+
+  //! execute iterations [first, last) of the loop
+  static void call(const void* obj, Index_type first, Index_type last)
+  {
+    const WorkGroupLoop& loop = *static_cast<const WorkGroupLoop*>(obj);
+
+    using std::begin;
+    auto begin_it = begin(loop.segment);
+
+    // each piece of the loop runs on a private copy of the body, so reducers
+    // behave as they do in forall
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(loop.body);
+    auto& body = privatizer.get_priv();
+    for (Index_type i = first; i < last; ++i) {
+      body(begin_it[i]);
+    }
+  }
+
+  static void destroy(void* obj)
+  {
+    static_cast<WorkGroupLoop*>(obj)->~WorkGroupLoop();
+  }
+};
+
+//! Executes one chunk of a WorkGroup's combined iteration space
+struct WorkGroupChunkBody {
+  const WorkGroupEntry* entries;
+  size_t num_entries;
+  Index_type num_iterations;
+  Index_type chunk_size;
+
+  template <typename ChunkIndex>
+  void operator()(ChunkIndex chunk) const
+  {
+    Index_type first = static_cast<Index_type>(chunk) * chunk_size;
+    const Index_type last = std::min(first + chunk_size, num_iterations);
+
+    // the loop containing iteration first
+    const WorkGroupEntry* entry =
+        std::upper_bound(entries,
+                         entries + num_entries,
+                         first,
+                         [](Index_type it, const WorkGroupEntry& e) {
+                           return it < e.offset;
+                         }) -
+        1;
+
+    while (first < last) {
+      const Index_type stop = std::min(last, entry->offset + entry->length);
+      entry->call(entry->obj, first - entry->offset, stop - entry->offset);
+      first = stop;
+      ++entry;
+    }
+  }
+};
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Batch of small, independent loops executed with a single dispatch.
+ *
+ *         Loops are added with enqueue(segment, body); run() then executes
+ *         every iteration of every loop with one launch of ExecPolicy.  The
+ *         combined iteration space is divided into chunks of ChunkSize
+ *         iterations, so threads receive equal numbers of iterations no
+ *         matter how the iterations are spread over the loops.  Loops in a
+ *         group must not depend on each other.
+ *
+ *         Segments and bodies are copied into blocks of memory taken from a
+ *         basic_mempool::MemPool.  A group may be run any number of times;
+ *         clear() discards its loops but keeps its memory, so a group that
+ *         is refilled every timestep stops allocating after the first one.
+ *
+ *         Only host execution policies are supported.
+ *
+ * Usage example:
+ *
+ * \verbatim
+ *
+ *   RAJA::WorkGroup<RAJA::omp_parallel_for_exec> pack;
+ *
+ *   for (int n = 0; n < num_neighbors; ++n) {
+ *     double* buf = buffers[n];
+ *     int* list = send_lists[n];
+ *     pack.enqueue(RAJA::RangeSegment(0, send_len[n]),
+ *                  [=](int i) { buf[i] = field[list[i]]; });
+ *   }
+ *
+ *   for (int step = 0; step < num_steps; ++step) {
+ *     pack.run();
+ *     ...
+ *   }
+ *
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename ExecPolicy,
+          Index_type ChunkSize = 256,
+          typename Allocator = basic_mempool::generic_allocator>
+class WorkGroup
+{
+  static_assert(ChunkSize > 0, "WorkGroup needs a positive chunk size");
+
+public:
+  using exec_policy = ExecPolicy;
+  using mempool_type = basic_mempool::MemPool<Allocator>;
+
+  //! size of the memory blocks holding enqueued segments and bodies
+  static constexpr size_t block_size = 16 * 1024;
+
+  WorkGroup() = default;
+
+  WorkGroup(const WorkGroup&) = delete;
+  WorkGroup& operator=(const WorkGroup&) = delete;
+
+  ~WorkGroup()
+  {
+    clear();
+    for (auto& block : m_blocks) {
+      mempool_type::getInstance().free(block.ptr);
+    }
+  }
+
+  //! Add a loop executing body(i) for each index i of segment.
+  template <typename Segment, typename Body>
+  void enqueue(Segment&& segment, Body&& body)
+  {
+    using loop_type = detail::WorkGroupLoop<camp::decay<Segment>,
+                                            camp::decay<Body>>;
+
+    using std::begin;
+    using std::distance;
+    using std::end;
+    const Index_type length = distance(begin(segment), end(segment));
+    if (length <= 0) return;
+
+    void* obj = allocate(sizeof(loop_type), alignof(loop_type));
+    new (obj) loop_type{std::forward<Segment>(segment),
+                        std::forward<Body>(body)};
+
+    m_entries.push_back(detail::WorkGroupEntry{obj,
+                                               &loop_type::call,
+                                               &loop_type::destroy,
+                                               m_num_iterations,
+                                               length});
+    m_num_iterations += length;
+  }
+
+  //! Execute every enqueued loop; returns when all of them have completed.
+  void run() const
+  {
+    util::PluginContext context{util::make_context<ExecPolicy>()};
+    util::callPreLaunchPlugins(context);
+
+    if (m_num_iterations > 0) {
+      const Index_type num_chunks =
+          (m_num_iterations + ChunkSize - 1) / ChunkSize;
+      detail::WorkGroupChunkBody body{m_entries.data(),
+                                      m_entries.size(),
+                                      m_num_iterations,
+                                      ChunkSize};
+      wrap::forall(ExecPolicy(), TypedRangeSegment<Index_type>(0, num_chunks),
+                   body);
+    }
+
+    util::callPostLaunchPlugins(context);
+  }
+
+  //! Remove all loops, keeping the memory for loops enqueued later.
+  void clear()
+  {
+    for (auto& entry : m_entries) {
+      entry.destroy(entry.obj);
+    }
+    m_entries.clear();
+    m_num_iterations = 0;
+    m_cur_block = 0;
+    m_cur_used = 0;
+  }
+
+  //! Number of enqueued loops.
+  size_t num_loops() const { return m_entries.size(); }
+
+  //! Total number of iterations of the enqueued loops.
+  Index_type num_iterations() const { return m_num_iterations; }
+
+private:
+  struct Block {
+    void* ptr;
+    size_t size;
+  };
+
+  //! storage for one enqueued loop, carved out of the current block
+  void* allocate(size_t size, size_t alignment)
+  {
+    for (; m_cur_block < m_blocks.size(); ++m_cur_block, m_cur_used = 0) {
+      Block& block = m_blocks[m_cur_block];
+      void* ptr = static_cast<char*>(block.ptr) + m_cur_used;
+      size_t space = block.size - m_cur_used;
+      if (RAJA::align(alignment, size, ptr, space)) {
+        m_cur_used = static_cast<char*>(ptr) + size
+                     - static_cast<char*>(block.ptr);
+        return ptr;
+      }
+    }
+
+    const size_t bytes = std::max(block_size, size + alignment);
+    void* ptr = mempool_type::getInstance().template malloc<char>(bytes,
+                                                                  alignment);
+    if (ptr == nullptr) {
+      RAJA_ABORT_OR_THROW("WorkGroup: allocation failed");
+    }
+    m_blocks.push_back(Block{ptr, bytes});
+    m_cur_used = size;
+    return ptr;
+  }
+
+  std::vector<detail::WorkGroupEntry> m_entries;
+  Index_type m_num_iterations = 0;
+
+  std::vector<Block> m_blocks;
+  size_t m_cur_block = 0;
+  size_t m_cur_used = 0;
+};
+
+template <typename ExecPolicy, Index_type ChunkSize, typename Allocator>
+constexpr size_t WorkGroup<ExecPolicy, ChunkSize, Allocator>::block_size;
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
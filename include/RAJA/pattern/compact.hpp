@@ -0,0 +1,547 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA stream compaction declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_HPP
+#define RAJA_compact_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "camp/concepts.hpp"
+#include "camp/helpers.hpp"
+
+#include "RAJA/index/ListSegment.hpp"
+
+#include "RAJA/pattern/detail/scan.hpp"
+#include "RAJA/pattern/scan.hpp"
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! Index_type if ExecPolicy is an execution policy and Iter an iterator
+template <typename ExecPolicy, typename Iter>
+using CompactResult = typename std::enable_if<
+    type_traits::is_execution_policy<ExecPolicy>::value &&
+        type_traits::is_iterator<Iter>::value,
+    Index_type>::type;
+
+//! Index_type if ExecPolicy is an execution policy and Container a range
+template <typename ExecPolicy, typename Container>
+using CompactRangeResult = typename std::enable_if<
+    type_traits::is_execution_policy<ExecPolicy>::value &&
+        type_traits::is_range<Container>::value,
+    Index_type>::type;
+
+/*!
+ * \brief Compacts [begin, begin + n) in place: the elements selected by sel
+ *        are moved in order to the front, the others are dropped, and the
+ *        number kept is returned.  The first pass copies, since sel may read
+ *        the neighbours of an element.
+ */
+template <typename ExecPolicy, typename Iter, typename SelectFn>
+Index_type compactInPlace(const ExecPolicy &p,
+                          Iter begin,
+                          Index_type n,
+                          SelectFn sel)
+{
+  using R = IterVal<Iter>;
+  std::vector<R> tmp(n);
+  const Index_type kept =
+      impl::scan::compact(p,
+                          begin,
+                          n,
+                          tmp.data(),
+                          impl::scan::detail::DiscardOutput{},
+                          sel);
+  impl::scan::compact(p,
+                      std::make_move_iterator(tmp.data()),
+                      kept,
+                      begin,
+                      impl::scan::detail::DiscardOutput{},
+                      impl::scan::detail::SelectAll{});
+  return kept;
+}
+
+}  // end namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  copy_if execution pattern
+*
+*         Copies the elements for which pred is true to out, keeping their
+*         relative order.
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of input range
+* \param[in] end Pointer or Random-Access Iterator to end of input range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output range
+* \param[in] pred unary predicate selecting the elements to copy
+*
+* \return the number of elements written to out
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename Predicate>
+detail::CompactResult<ExecPolicy, Iter> copy_if(const ExecPolicy &p,
+                                                Iter begin,
+                                                Iter end,
+                                                OutIter out,
+                                                Predicate pred)
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<OutIter>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return 0;
+  }
+  return impl::scan::compact(
+      p,
+      begin,
+      std::distance(begin, end),
+      out,
+      impl::scan::detail::DiscardOutput{},
+      impl::scan::detail::ValueSelect<Iter, Predicate>{begin, pred});
+}
+
+/*!
+******************************************************************************
+*
+* \brief  copy_if execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] c Random-Access Container
+* \param[out] out Pointer or Random-Access Iterator to start of output range
+* \param[in] pred unary predicate selecting the elements to copy
+*
+* \return the number of elements written to out
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename OutIter,
+          typename Predicate>
+detail::CompactRangeResult<ExecPolicy, Container> copy_if(const ExecPolicy &p,
+                                                          Container &c,
+                                                          OutIter out,
+                                                          Predicate pred)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  return RAJA::copy_if(p, std::begin(c), std::end(c), out, pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  remove_if execution pattern
+*
+*         Removes the elements for which pred is true, moving the others to
+*         the front of the range in their original order.  Elements past
+*         the returned count are left in a valid but unspecified state.
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] pred unary predicate selecting the elements to remove
+*
+* \return the number of elements kept
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Iter, typename Predicate>
+detail::CompactResult<ExecPolicy, Iter> remove_if(const ExecPolicy &p,
+                                                  Iter begin,
+                                                  Iter end,
+                                                  Predicate pred)
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return 0;
+  }
+  return detail::compactInPlace(
+      p,
+      begin,
+      std::distance(begin, end),
+      impl::scan::detail::ValueReject<Iter, Predicate>{begin, pred});
+}
+
+/*!
+******************************************************************************
+*
+* \brief  remove_if execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] c Random-Access Container
+* \param[in] pred unary predicate selecting the elements to remove
+*
+* \return the number of elements kept
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Container, typename Predicate>
+detail::CompactRangeResult<ExecPolicy, Container> remove_if(
+    const ExecPolicy &p,
+    Container &c,
+    Predicate pred)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  return RAJA::remove_if(p, std::begin(c), std::end(c), pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  partition_copy execution pattern
+*
+*         Copies the elements for which pred is true to out_true and the
+*         others to out_false, each in their original order.
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of input range
+* \param[in] end Pointer or Random-Access Iterator to end of input range
+*(exclusive)
+* \param[out] out_true Random-Access Iterator receiving the selected elements
+* \param[out] out_false Random-Access Iterator receiving the other elements
+* \param[in] pred unary predicate selecting the elements
+*
+* \return the number of elements written to out_true
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutTrue,
+          typename OutFalse,
+          typename Predicate>
+detail::CompactResult<ExecPolicy, Iter> partition_copy(const ExecPolicy &p,
+                                                       Iter begin,
+                                                       Iter end,
+                                                       OutTrue out_true,
+                                                       OutFalse out_false,
+                                                       Predicate pred)
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return 0;
+  }
+  return impl::scan::compact(
+      p,
+      begin,
+      std::distance(begin, end),
+      out_true,
+      out_false,
+      impl::scan::detail::ValueSelect<Iter, Predicate>{begin, pred});
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable partition execution pattern
+*
+*         Reorders the range so the elements for which pred is true come
+*         first; both groups keep their original relative order.
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] pred unary predicate selecting the elements placed first
+*
+* \return the number of elements for which pred is true
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Iter, typename Predicate>
+detail::CompactResult<ExecPolicy, Iter> partition(const ExecPolicy &p,
+                                                  Iter begin,
+                                                  Iter end,
+                                                  Predicate pred)
+{
+  using R = detail::IterVal<Iter>;
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return 0;
+  }
+  const Index_type n = std::distance(begin, end);
+  std::vector<R> tmp(n);
+  // the rejected elements fill tmp back to front so one pass places both
+  auto back = std::reverse_iterator<R *>(tmp.data() + n);
+  const Index_type kept = impl::scan::compact(
+      p,
+      std::make_move_iterator(begin),
+      n,
+      tmp.data(),
+      back,
+      impl::scan::detail::ValueSelect<Iter, Predicate>{begin, pred});
+  impl::scan::compact(p,
+                      std::make_move_iterator(tmp.data()),
+                      kept,
+                      begin,
+                      impl::scan::detail::DiscardOutput{},
+                      impl::scan::detail::SelectAll{});
+  impl::scan::compact(p,
+                      std::make_move_iterator(back),
+                      n - kept,
+                      begin + kept,
+                      impl::scan::detail::DiscardOutput{},
+                      impl::scan::detail::SelectAll{});
+  return kept;
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable partition execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] c Random-Access Container
+* \param[in] pred unary predicate selecting the elements placed first
+*
+* \return the number of elements for which pred is true
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Container, typename Predicate>
+detail::CompactRangeResult<ExecPolicy, Container> partition(
+    const ExecPolicy &p,
+    Container &c,
+    Predicate pred)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  return RAJA::partition(p, std::begin(c), std::end(c), pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  unique_copy execution pattern
+*
+*         Copies the first element of every run of consecutive equal
+*         elements to out.
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of input range
+* \param[in] end Pointer or Random-Access Iterator to end of input range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output range
+* \param[in] eq binary predicate comparing neighbouring elements
+*
+* \return the number of elements written to out
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename BinaryPredicate =
+              operators::equal_to<detail::IterVal<Iter>>>
+detail::CompactResult<ExecPolicy, Iter> unique_copy(
+    const ExecPolicy &p,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinaryPredicate eq = BinaryPredicate{})
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return 0;
+  }
+  return impl::scan::compact(
+      p,
+      begin,
+      std::distance(begin, end),
+      out,
+      impl::scan::detail::DiscardOutput{},
+      impl::scan::detail::UniqueSelect<Iter, BinaryPredicate>{begin, eq});
+}
+
+/*!
+******************************************************************************
+*
+* \brief  unique execution pattern
+*
+*         Keeps the first element of every run of consecutive equal elements,
+*         moving the kept elements to the front of the range in order.
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] eq binary predicate comparing neighbouring elements
+*
+* \return the number of elements kept
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename BinaryPredicate =
+              operators::equal_to<detail::IterVal<Iter>>>
+detail::CompactResult<ExecPolicy, Iter> unique(
+    const ExecPolicy &p,
+    Iter begin,
+    Iter end,
+    BinaryPredicate eq = BinaryPredicate{})
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return 0;
+  }
+  return detail::compactInPlace(
+      p,
+      begin,
+      std::distance(begin, end),
+      impl::scan::detail::UniqueSelect<Iter, BinaryPredicate>{begin, eq});
+}
+
+/*!
+******************************************************************************
+*
+* \brief  unique execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] c Random-Access Container
+* \param[in] eq binary predicate comparing neighbouring elements
+*
+* \return the number of elements kept
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename BinaryPredicate =
+              operators::equal_to<detail::ContainerVal<Container>>>
+detail::CompactRangeResult<ExecPolicy, Container> unique(
+    const ExecPolicy &p,
+    Container &c,
+    BinaryPredicate eq = BinaryPredicate{})
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  return RAJA::unique(p, std::begin(c), std::end(c), eq);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  Builds a list segment of the indices in [begin, end) for which
+*         pred is true, in increasing order.
+*
+*         Typical use is iterating a RangeSegment to gather the indices a
+*         later forall should visit, e.g. the cells of one material.
+*
+* \param[in] p Execution policy
+* \param[in] begin Random-Access Iterator to start of the index range
+* \param[in] end Random-Access Iterator to end of the index range (exclusive)
+* \param[in] pred unary predicate on an index selecting it
+*
+* \return a list segment owning a copy of the selected indices
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Iter, typename Predicate>
+TypedListSegment<detail::IterVal<Iter>> make_list_segment_if(
+    const ExecPolicy &p,
+    Iter begin,
+    Iter end,
+    Predicate pred)
+{
+  using T = detail::IterVal<Iter>;
+  static_assert(type_traits::is_execution_policy<ExecPolicy>::value,
+                "ExecPolicy must be an execution policy");
+  std::vector<T> indices(std::distance(begin, end));
+  const Index_type count = RAJA::copy_if(p, begin, end, indices.data(), pred);
+  return TypedListSegment<T>(indices.data(), count);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto copy_if(Args &&... args)
+    -> decltype(copy_if(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return copy_if(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto remove_if(Args &&... args)
+    -> decltype(remove_if(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return remove_if(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto partition_copy(Args &&... args)
+    -> decltype(partition_copy(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return partition_copy(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto partition(Args &&... args)
+    -> decltype(partition(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return partition(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto unique_copy(Args &&... args)
+    -> decltype(unique_copy(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return unique_copy(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto unique(Args &&... args)
+    -> decltype(unique(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return unique(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto make_list_segment_if(Args &&... args) -> decltype(
+    make_list_segment_if(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return make_list_segment_if(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,170 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief  Back-end independent pieces of RAJA::forall_param: reduction
+ *         parameters and the accumulators the loop body writes to.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_DETAIL_FORALL_PARAM_HPP
+#define RAJA_PATTERN_DETAIL_FORALL_PARAM_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+#include <utility>
+
+#include "camp/camp.hpp"
+#include "camp/tuple.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Reduction parameter of RAJA::forall_param; see RAJA::Reduce.
+ *
+ *        The loop body gets a T& to an accumulator that starts at the
+ *        identity of Op; after the loop the accumulators are combined with
+ *        Op into *target.
+ */
+template <typename T, template <typename...> class Op>
+struct ReduceParam {
+  using value_type = T;
+  using op_type = Op<T, T, T>;
+
+  T* target;
+
+  static T identity() { return op_type::identity(); }
+
+  static void combine(T& acc, T const& val) { acc = op_type{}(acc, val); }
+};
+
+template <typename T>
+struct is_forall_param : std::false_type {
+};
+
+template <typename T, template <typename...> class Op>
+struct is_forall_param<ReduceParam<T, Op>> : std::true_type {
+};
+
+template <typename... Ts>
+struct all_forall_params : std::true_type {
+};
+
+template <typename T, typename... Ts>
+struct all_forall_params<T, Ts...>
+    : std::integral_constant<bool,
+                             is_forall_param<T>::value &&
+                                 all_forall_params<Ts...>::value> {
+};
+
+/*!
+ * \brief The parameters of one forall_param call, and the operations on
+ *        a set of accumulators for them.
+ */
+template <typename... Params>
+struct ForallParamPack {
+  static_assert(all_forall_params<Params...>::value,
+                "forall_param arguments between the container and the loop "
+                "body must be reduction parameters such as "
+                "RAJA::Reduce<operators::plus>(&x)");
+
+  using values_type = camp::tuple<typename Params::value_type...>;
+
+  camp::tuple<Params...> params;
+
+  //! accumulators at the identity of each parameter
+  values_type identities() const
+  {
+    return values_type(Params::identity()...);
+  }
+
+  //! folds other into acc
+  void combine(values_type& acc, values_type const& other) const
+  {
+    combineEach(acc, other, camp::make_idx_seq_t<sizeof...(Params)>{});
+  }
+
+  //! folds acc into the targets of the parameters
+  void finalize(values_type const& acc) const
+  {
+    finalizeEach(acc, camp::make_idx_seq_t<sizeof...(Params)>{});
+  }
+
+private:
+  template <camp::idx_t... Is>
+  static void combineEach(values_type& acc,
+                          values_type const& other,
+                          camp::idx_seq<Is...>)
+  {
+    int order[] = {
+        0, (Params::combine(camp::get<Is>(acc), camp::get<Is>(other)), 0)...};
+    RAJA_UNUSED_VAR(order);
+  }
+
+  template <camp::idx_t... Is>
+  void finalizeEach(values_type const& acc, camp::idx_seq<Is...>) const
+  {
+    int order[] = {0,
+                   (Params::combine(*camp::get<Is>(params).target,
+                                    camp::get<Is>(acc)),
+                    0)...};
+    RAJA_UNUSED_VAR(order);
+  }
+};
+
+/*!
+ * \brief Loop body handed to the forall back-ends: calls the user body as
+ *        body(i, acc...) with references to one thread's accumulators.
+ *
+ *        Holds references only, so copies made by a back-end are cheap and
+ *        share no state with other threads.
+ */
+template <typename Func, typename Values>
+struct ForallParamBody {
+  Func const& body;
+  Values& values;
+
+  template <typename Index>
+  void operator()(Index&& i) const
+  {
+    call(std::forward<Index>(i),
+         camp::make_idx_seq_t<camp::tuple_size<Values>::value>{});
+  }
+
+private:
+  template <typename Index, camp::idx_t... Is>
+  void call(Index&& i, camp::idx_seq<Is...>) const
+  {
+    body(std::forward<Index>(i), camp::get<Is>(values)...);
+  }
+};
+
+template <typename Func, typename Values>
+RAJA_INLINE ForallParamBody<Func, Values> makeForallParamBody(
+    Func const& body,
+    Values& values)
+{
+  return ForallParamBody<Func, Values>{body, values};
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif /* RAJA_PATTERN_DETAIL_FORALL_PARAM_HPP */
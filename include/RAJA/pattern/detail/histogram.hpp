@@ -0,0 +1,344 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing the back-end independent histogram and
+*          reduce-by-key engine.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_DETAIL_HISTOGRAM_HPP
+#define RAJA_PATTERN_DETAIL_HISTOGRAM_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/detail/scan.hpp"
+#include "RAJA/pattern/detail/sort.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace histogram
+{
+namespace detail
+{
+
+//! Histograms shorter than this are binned by a single thread
+constexpr Index_type histogramMinSize = 4096;
+
+/*!
+ * Per-thread bin copies are used while p copies of the bins are no larger
+ * than this many times the input; beyond that the keys are sorted and each
+ * run of equal keys is summed instead.
+ */
+constexpr Index_type privatizeRatio = 4;
+
+//! Weight of every key of an unweighted histogram
+struct UnitWeight {
+  int operator()(Index_type) const { return 1; }
+};
+
+//! Weight of key i of a weighted histogram
+template <typename WeightIter>
+struct IterWeight {
+  WeightIter weights;
+
+  typename std::iterator_traits<WeightIter>::reference operator()(
+      Index_type i) const
+  {
+    return *(weights + i);
+  }
+};
+
+/*!
+ * \brief First index at or after i that starts a run of keys equal under
+ *        pred, or n.  Blocks cut at run starts never split a run.
+ */
+template <typename KeyIter, typename Predicate>
+Index_type runStart(KeyIter keys, Index_type n, Index_type i, Predicate pred)
+{
+  while (i > 0 && i < n && pred(*(keys + (i - 1)), *(keys + i))) {
+    ++i;
+  }
+  return i;
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Reduce by key of [keys, keys + n) over p blocks cut at run starts.
+ *
+ *         Phase one counts the runs of each block but the last; phase two
+ *         reduces every run of its block with op and writes its key and
+ *         value at the number of runs before it.  The last block stores
+ *         the total in *count.  Same two-phase shape as the scan engine.
+ *
+ ******************************************************************************
+ */
+template <typename KeyIter,
+          typename ValIter,
+          typename KeyOut,
+          typename ValOut,
+          typename BinFn,
+          typename Predicate>
+struct ReduceByKeyBlocks {
+  using total_type = Index_type;
+
+  KeyIter keys;
+  ValIter vals;
+  KeyOut keys_out;
+  ValOut vals_out;
+  BinFn op;
+  Predicate pred;
+  Index_type n;
+  Index_type* count;
+  total_type* sums;
+
+  Index_type blockFirst(Index_type pid, Index_type p) const
+  {
+    return runStart(keys, n, scan::detail::scanBlockFirst(n, p, pid), pred);
+  }
+
+  //! Phase one: number of runs of block pid of p
+  void reduce(Index_type pid, Index_type p) const
+  {
+    const Index_type i0 = blockFirst(pid, p);
+    const Index_type i1 = blockFirst(pid + 1, p);
+    Index_type runs = 0;
+    for (Index_type i = i0; i < i1; ++i) {
+      runs += (i == i0 || !pred(*(keys + (i - 1)), *(keys + i))) ? 1 : 0;
+    }
+    sums[pid] = runs;
+  }
+
+  //! Phase two: reduce the runs of block pid of p after those before it
+  void scan(Index_type pid, Index_type p) const
+  {
+    const Index_type i0 = blockFirst(pid, p);
+    const Index_type i1 = blockFirst(pid + 1, p);
+    Index_type k = 0;
+    for (Index_type b = 0; b < pid; ++b) {
+      k += sums[b];
+    }
+    Index_type i = i0;
+    while (i < i1) {
+      const Index_type first = i;
+      auto value = *(vals + i);
+      for (++i; i < i1 && pred(*(keys + (i - 1)), *(keys + i)); ++i) {
+        value = op(value, *(vals + i));
+      }
+      *(keys_out + k) = *(keys + first);
+      *(vals_out + k) = value;
+      ++k;
+    }
+    if (pid == p - 1) {
+      *count = k;
+    }
+  }
+};
+
+//! Runs a two-phase block engine (BlockScan, ReduceByKeyBlocks) on for_blocks
+template <typename ForBlocks, typename Blocks>
+void runBlocks(const ForBlocks& for_blocks, Index_type p, Blocks blocks)
+{
+  std::vector<typename Blocks::total_type> sums(p);
+  blocks.sums = sums.data();
+  for_blocks(p - 1, [&](Index_type pid) { blocks.reduce(pid, p); });
+  for_blocks(p, [&](Index_type pid) { blocks.scan(pid, p); });
+}
+
+/*!
+ * \brief Reduces every run of equal keys of [keys, keys + n) with op; returns
+ *        the number of runs.
+ */
+template <typename ForBlocks,
+          typename KeyIter,
+          typename ValIter,
+          typename KeyOut,
+          typename ValOut,
+          typename BinFn,
+          typename Predicate>
+Index_type reduceByKeyEngine(const ForBlocks& for_blocks,
+                             Index_type p,
+                             KeyIter keys,
+                             Index_type n,
+                             ValIter vals,
+                             KeyOut keys_out,
+                             ValOut vals_out,
+                             BinFn op,
+                             Predicate pred)
+{
+  if (n <= 0) {
+    return 0;
+  }
+  p = (n < histogramMinSize) ? 1 : std::min(p, n);
+  Index_type count = 0;
+  runBlocks(for_blocks,
+            p,
+            ReduceByKeyBlocks<KeyIter,
+                              ValIter,
+                              KeyOut,
+                              ValOut,
+                              BinFn,
+                              Predicate>{keys,
+                                         vals,
+                                         keys_out,
+                                         vals_out,
+                                         op,
+                                         pred,
+                                         n,
+                                         &count,
+                                         nullptr});
+  return count;
+}
+
+/*!
+ * \brief Every thread bins its block into its own copy of the bins, which
+ *        it first-touches; the copies are then summed into bins in
+ *        parallel over contiguous ranges of bins.
+ */
+template <typename ForBlocks,
+          typename KeyIter,
+          typename WeightFn,
+          typename BinIter>
+void privatizedHistogram(const ForBlocks& for_blocks,
+                         Index_type p,
+                         KeyIter keys,
+                         Index_type n,
+                         WeightFn weight,
+                         BinIter bins,
+                         Index_type num_bins)
+{
+  using Bin = typename std::decay<decltype(*bins)>::type;
+  std::unique_ptr<Bin[]> priv(new Bin[p * num_bins]);
+
+  for_blocks(p, [&](Index_type pid) {
+    Bin* mine = priv.get() + pid * num_bins;
+    std::fill(mine, mine + num_bins, Bin());
+    const Index_type i1 = scan::detail::scanBlockFirst(n, p, pid + 1);
+    for (Index_type i = scan::detail::scanBlockFirst(n, p, pid); i < i1; ++i) {
+      mine[*(keys + i)] += weight(i);
+    }
+  });
+
+  for_blocks(p, [&](Index_type pid) {
+    const Index_type b1 = scan::detail::scanBlockFirst(num_bins, p, pid + 1);
+    for (Index_type b = scan::detail::scanBlockFirst(num_bins, p, pid); b < b1;
+         ++b) {
+      Bin sum = *(bins + b);
+      for (Index_type q = 0; q < p; ++q) {
+        sum += priv[q * num_bins + b];
+      }
+      *(bins + b) = sum;
+    }
+  });
+}
+
+/*!
+ * \brief Sorts copies of the keys and weights so that every bin is one run,
+ *        then each block, cut at run starts, adds its runs to their bins.
+ *        No two blocks touch the same bin.
+ */
+template <typename ForBlocks,
+          typename KeyIter,
+          typename WeightFn,
+          typename BinIter>
+void sortedHistogram(const ForBlocks& for_blocks,
+                     Index_type p,
+                     KeyIter keys,
+                     Index_type n,
+                     WeightFn weight,
+                     BinIter bins)
+{
+  using Key = typename std::decay<decltype(*keys)>::type;
+  using Bin = typename std::decay<decltype(*bins)>::type;
+  std::vector<Key> k(n);
+  std::vector<Bin> w(n);
+
+  for_blocks(p, [&](Index_type pid) {
+    const Index_type i1 = scan::detail::scanBlockFirst(n, p, pid + 1);
+    for (Index_type i = scan::detail::scanBlockFirst(n, p, pid); i < i1; ++i) {
+      k[i] = *(keys + i);
+      w[i] = weight(i);
+    }
+  });
+
+  sort::detail::sortPairsEngine<false>(
+      for_blocks, p, k.begin(), k.end(), w.begin(), operators::less<Key>{});
+
+  const operators::equal_to<Key> eq{};
+  for_blocks(p, [&](Index_type pid) {
+    const Index_type i0 = scan::detail::scanBlockFirst(n, p, pid);
+    const Index_type i1 = runStart(
+        k.begin(), n, scan::detail::scanBlockFirst(n, p, pid + 1), eq);
+    Index_type i = runStart(k.begin(), n, i0, eq);
+    while (i < i1) {
+      const Key key = k[i];
+      Bin sum = w[i];
+      for (++i; i < i1 && k[i] == key; ++i) {
+        sum += w[i];
+      }
+      *(bins + key) += sum;
+    }
+  });
+}
+
+/*!
+ * \brief Adds weight(i) to bins[keys[i]] for every i in [0, n).
+ *
+ *        Picks privatized bins while p copies of them are cheap next to
+ *        the input, and sorting with a run-wise sum otherwise.
+ */
+template <typename ForBlocks,
+          typename KeyIter,
+          typename WeightFn,
+          typename BinIter>
+void histogramEngine(const ForBlocks& for_blocks,
+                     Index_type p,
+                     KeyIter keys,
+                     Index_type n,
+                     WeightFn weight,
+                     BinIter bins,
+                     Index_type num_bins)
+{
+  if (n < histogramMinSize || p <= 1) {
+    for (Index_type i = 0; i < n; ++i) {
+      *(bins + *(keys + i)) += weight(i);
+    }
+    return;
+  }
+  if (num_bins * p <= privatizeRatio * n) {
+    privatizedHistogram(for_blocks, p, keys, n, weight, bins, num_bins);
+  } else {
+    sortedHistogram(for_blocks, p, keys, n, weight, bins);
+  }
+}
+
+}  // namespace detail
+
+}  // namespace histogram
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif /* RAJA_PATTERN_DETAIL_HISTOGRAM_HPP */
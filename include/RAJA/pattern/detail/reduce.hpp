@@ -18,6 +18,14 @@
 #ifndef RAJA_PATTERN_DETAIL_REDUCE_HPP
 #define RAJA_PATTERN_DETAIL_REDUCE_HPP
 
+#include "RAJA/config.hpp"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "RAJA/pattern/reduce.hpp"
+
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/types.hpp"
 
@@ -48,6 +56,30 @@
   RAJA_DECLARE_INDEX_REDUCER(MinLoc, POL, COMBINER)    \
   RAJA_DECLARE_INDEX_REDUCER(MaxLoc, POL, COMBINER)
 
+#define RAJA_DECLARE_ARRAY_REDUCER(POL, COMBINER)                     \
+  template <typename T, Index_type N>                                 \
+  class ReduceSumArray<POL, T, N>                                     \
+      : public reduce::detail::BaseReduceSumArray<T, N, COMBINER>     \
+  {                                                                   \
+  public:                                                             \
+    using Base = reduce::detail::BaseReduceSumArray<T, N, COMBINER>;  \
+    using Base::Base;                                                 \
+  };
+
+#define RAJA_DECLARE_GENERIC_REDUCER(POL, COMBINER)                 \
+  template <typename T, typename Op>                                \
+  class Reducer<POL, T, Op>                                         \
+      : public reduce::detail::BaseReducer<T, Op, COMBINER>         \
+  {                                                                 \
+  public:                                                           \
+    using Base = reduce::detail::BaseReducer<T, Op, COMBINER>;      \
+    using Base::Base;                                               \
+                                                                    \
+    RAJA_SUPPRESS_HD_WARN                                           \
+    RAJA_HOST_DEVICE                                                \
+    Reducer() : Base(Op::identity(), Op::identity()) {}             \
+  };
+
 namespace RAJA
 {
 
@@ -92,6 +124,53 @@ struct max : detail::op_adapter<T, RAJA::operators::maximum> {
 #pragma omp end declare target
 #endif
 
+/*!
+ * \brief Element-wise sum of arrays of equal size, done in one pass the
+ *        compiler can vectorize.
+ */
+template <typename Array>
+struct sum_array {
+  struct operator_type {
+    Array operator()(Array lhs, Array const &rhs) const
+    {
+      sum_array{}(lhs, rhs);
+      return lhs;
+    }
+  };
+
+  static Array identity() { return Array{}; }
+
+  void operator()(Array &val, Array const &v) const
+  {
+    auto *RAJA_RESTRICT out = val.data();
+    auto const *RAJA_RESTRICT in = v.data();
+    const std::size_t n = val.size();
+    RAJA_SIMD
+    for (std::size_t i = 0; i < n; ++i) {
+      out[i] += in[i];
+    }
+  }
+};
+
+/*!
+ * \brief Adapts a user combine operator, Op{}(a, b) returning the combined
+ *        value and Op::identity(), to the interface of the reduce ops.
+ */
+template <typename Op>
+struct custom_op {
+  template <typename T>
+  struct apply {
+    using operator_type = Op;
+
+    RAJA_HOST_DEVICE static T identity() { return Op::identity(); }
+
+    RAJA_HOST_DEVICE RAJA_INLINE void operator()(T &val, const T v) const
+    {
+      val = Op{}(val, v);
+    }
+  };
+};
+
 namespace detail
 {
 
@@ -227,6 +306,23 @@ public:
   T get() const { return c.get(); }
 };
 
+/*!
+ * \brief False only if val is known to equal identity; types without
+ *        operator!= are always folded.
+ */
+template <typename T>
+RAJA_HOST_DEVICE constexpr auto differs(T const &val, T const &identity, int)
+    -> decltype(bool(val != identity))
+{
+  return bool(val != identity);
+}
+
+template <typename T>
+RAJA_HOST_DEVICE constexpr bool differs(T const &, T const &, long)
+{
+  return true;
+}
+
 template <typename T, typename Reduce, typename Derived>
 class BaseCombinable
 {
@@ -264,11 +360,13 @@ public:
   {
   }
 
+  //! folds a copy into its parent; back-ends that fold copies themselves,
+  //! under a lock or into a slot, clear parent so this does nothing
   RAJA_SUPPRESS_HD_WARN
   RAJA_HOST_DEVICE
   ~BaseCombinable()
   {
-    if (parent && my_data != identity) {
+    if (parent && differs(my_data, identity, 0)) {
       Reduce()(parent->my_data, my_data);
     }
   }
@@ -462,6 +560,147 @@ public:
   operator T() const { return Base::get(); }
 };
 
+//! One sum of an array reducer; it can only be added to
+template <typename T>
+class SumArrayElement
+{
+  T &val;
+
+public:
+  explicit SumArrayElement(T &val_) : val(val_) {}
+
+  const SumArrayElement &operator+=(T rhs) const
+  {
+    val += rhs;
+    return *this;
+  }
+};
+
+/*!
+ **************************************************************************
+ *
+ * \brief  Sum array reducer class template.
+ *
+ *         Reduces many sums in one object: each thread-private copy holds
+ *         one contiguous buffer of partial sums, and a copy is folded into
+ *         its parent element-wise in a single pass, instead of one merge
+ *         per sum.
+ *
+ **************************************************************************
+ */
+template <typename Array, template <typename, typename> class Combiner>
+class BaseReduceSumArrayT
+    : public BaseReduce<Array, RAJA::reduce::sum_array, Combiner>
+{
+public:
+  using Base = BaseReduce<Array, RAJA::reduce::sum_array, Combiner>;
+  using element_type = typename Array::value_type;
+  using Base::Base;
+
+  //! reducer function; sum k of the current instance
+  SumArrayElement<element_type> operator[](Index_type k) const
+  {
+    return SumArrayElement<element_type>(this->local()[k]);
+  }
+};
+
+//! Sum array reducer with N sums, held inline
+template <typename T, Index_type N, template <typename, typename> class Combiner>
+class BaseReduceSumArray
+    : public BaseReduceSumArrayT<std::array<T, static_cast<std::size_t>(N)>,
+                                 Combiner>
+{
+  using array_type = std::array<T, static_cast<std::size_t>(N)>;
+
+  static array_type filled(T val)
+  {
+    array_type vals;
+    vals.fill(val);
+    return vals;
+  }
+
+public:
+  using Base = BaseReduceSumArrayT<array_type, Combiner>;
+
+  //! every sum starts at init_val
+  explicit BaseReduceSumArray(T init_val = T())
+      : Base(filled(init_val), filled(T()))
+  {
+  }
+
+  explicit BaseReduceSumArray(array_type const &init_vals)
+      : Base(init_vals, filled(T()))
+  {
+  }
+
+  void reset(T init_val = T()) { Base::reset(filled(init_val), filled(T())); }
+};
+
+//! Sum array reducer whose number of sums is given at construction
+template <typename T, template <typename, typename> class Combiner>
+class BaseReduceSumArray<T, dynamic_reduce_size, Combiner>
+    : public BaseReduceSumArrayT<std::vector<T>, Combiner>
+{
+  using array_type = std::vector<T>;
+
+  Index_type num_sums;
+
+public:
+  using Base = BaseReduceSumArrayT<array_type, Combiner>;
+
+  //! all n sums start at init_val
+  explicit BaseReduceSumArray(Index_type n, T init_val = T())
+      : Base(array_type(n, init_val), array_type(n, T())), num_sums(n)
+  {
+  }
+
+  explicit BaseReduceSumArray(array_type const &init_vals)
+      : Base(init_vals, array_type(init_vals.size(), T())),
+        num_sums(init_vals.size())
+  {
+  }
+
+  void reset(T init_val = T())
+  {
+    Base::reset(array_type(num_sums, init_val), array_type(num_sums, T()));
+  }
+};
+
+/*!
+ **************************************************************************
+ *
+ * \brief  Reducer class template for a user-defined combine operator.
+ *
+ *         Op{}(a, b) must return a and b combined, associatively, and
+ *         Op::identity() the value that leaves any value unchanged, unless
+ *         the identity is given at construction.  T may be a struct, so
+ *         several statistics can be reduced in one pass.
+ *
+ **************************************************************************
+ */
+template <typename T, typename Op, template <typename, typename> class Combiner>
+class BaseReducer
+    : public BaseReduce<T, custom_op<Op>::template apply, Combiner>
+{
+public:
+  using Base = BaseReduce<T, custom_op<Op>::template apply, Combiner>;
+  using Base::Base;
+
+  //! start from the identity, T() need not leave values unchanged
+  RAJA_SUPPRESS_HD_WARN
+  RAJA_HOST_DEVICE
+  BaseReducer() : Base(Op::identity(), Op::identity()) {}
+
+  //! reducer function; updates the current instance's state
+  RAJA_SUPPRESS_HD_WARN
+  RAJA_HOST_DEVICE
+  const BaseReducer &combine(T const &rhs) const
+  {
+    Base::combine(rhs);
+    return *this;
+  }
+};
+
 }  // namespace detail
 
 }  // namespace reduce
@@ -0,0 +1,408 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief  Base types used in common for RAJA reproducible reducer objects.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_DETAIL_REDUCE_REPRODUCIBLE_HPP
+#define RAJA_PATTERN_DETAIL_REDUCE_REPRODUCIBLE_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "RAJA/pattern/detail/reduce.hpp"
+
+#include "RAJA/util/TypeConvert.hpp"
+
+namespace RAJA
+{
+
+namespace reduce
+{
+
+namespace detail
+{
+
+//! Bit layout of the IEEE-754 binary formats an ExactSum can hold
+template <typename T>
+struct FloatLayout;
+
+template <>
+struct FloatLayout<float> {
+  using bits_type = std::uint32_t;
+  static constexpr int mantissa_bits = 23;
+  static constexpr int exponent_bits = 8;
+};
+
+template <>
+struct FloatLayout<double> {
+  using bits_type = std::uint64_t;
+  static constexpr int mantissa_bits = 52;
+  static constexpr int exponent_bits = 11;
+};
+
+template <typename T>
+struct is_exact_summable
+    : std::integral_constant<bool,
+                             std::is_same<T, float>::value ||
+                                 std::is_same<T, double>::value> {
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Exact, order-independent sum of floating-point values.
+ *
+ *         Every finite value of T is an integer multiple of the smallest
+ *         subnormal, so the sum is kept as a fixed-point integer spanning
+ *         the whole exponent range, in 32-bit digits held in 64-bit words.
+ *         Adding a value touches at most three digits and never rounds, so
+ *         any two ExactSums of the same values, added and merged in any
+ *         order, hold the same number.  get() rounds it to the nearest T
+ *         once, so the result is also correctly rounded.
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class ExactSum
+{
+  using Layout = FloatLayout<T>;
+  using bits_type = typename Layout::bits_type;
+
+  static constexpr int digit_bits = 32;
+  static constexpr std::uint64_t digit_mask = 0xffffffffu;
+  static constexpr std::int64_t digit_base = std::int64_t(1) << digit_bits;
+
+  static constexpr int max_biased_exponent =
+      (1 << Layout::exponent_bits) - 1;
+
+  //! exponent of bit 0 of digit 0, the last bit of the smallest subnormal
+  static constexpr int min_exponent =
+      2 - (1 << (Layout::exponent_bits - 1)) - Layout::mantissa_bits;
+
+  //! digits up to the top bit of the largest finite value, plus two for
+  //! carries out of sums that overflow T
+  static constexpr int num_digits =
+      (max_biased_exponent - 2 + Layout::mantissa_bits) / digit_bits + 3;
+
+  //! each add moves a digit by less than 2^32, so 2^30 of them fit in 63 bits
+  static constexpr std::int64_t max_pending = std::int64_t(1) << 30;
+
+  std::int64_t digits[num_digits];
+  std::int64_t pending;
+  T special;
+  bool has_special;
+
+  //! carries every digit but the last into [0, 2^32)
+  void normalize()
+  {
+    for (int k = 0; k < num_digits - 1; ++k) {
+      const std::int64_t low = static_cast<std::int64_t>(
+          static_cast<std::uint64_t>(digits[k]) & digit_mask);
+      digits[k + 1] += (digits[k] - low) / digit_base;
+      digits[k] = low;
+    }
+    pending = 0;
+  }
+
+public:
+  ExactSum() : digits{}, pending{0}, special{0}, has_special{false} {}
+
+  explicit ExactSum(T val) : ExactSum() { add(val); }
+
+  void add(T val)
+  {
+    const bits_type bits = util::reinterp_A_as_B<T, bits_type>(val);
+    const int biased = static_cast<int>((bits >> Layout::mantissa_bits) &
+                                        max_biased_exponent);
+    std::uint64_t mag =
+        bits & ((bits_type(1) << Layout::mantissa_bits) - bits_type(1));
+
+    if (biased == max_biased_exponent) {
+      // infinities and NaNs cannot be held exactly; they decide the result
+      special += val;
+      has_special = true;
+      return;
+    }
+    if (biased != 0) {
+      mag |= std::uint64_t(1) << Layout::mantissa_bits;
+    } else if (mag == 0) {
+      return;
+    }
+
+    const int shift = (biased != 0 ? biased : 1) - 1;
+    const int d = shift / digit_bits;
+    const int s = shift % digit_bits;
+    const std::uint64_t high = mag >> (digit_bits - s);
+    const std::int64_t part0 =
+        static_cast<std::int64_t>((mag << s) & digit_mask);
+    const std::int64_t part1 = static_cast<std::int64_t>(high & digit_mask);
+    const std::int64_t part2 = static_cast<std::int64_t>(high >> digit_bits);
+
+    if (bits >> (sizeof(bits_type) * 8 - 1)) {
+      digits[d] -= part0;
+      digits[d + 1] -= part1;
+      digits[d + 2] -= part2;
+    } else {
+      digits[d] += part0;
+      digits[d + 1] += part1;
+      digits[d + 2] += part2;
+    }
+
+    if (++pending == max_pending) {
+      normalize();
+    }
+  }
+
+  void merge(ExactSum other)
+  {
+    other.normalize();
+    normalize();
+    for (int k = 0; k < num_digits; ++k) {
+      digits[k] += other.digits[k];
+    }
+    pending = 2;
+    special += other.special;
+    has_special = has_special || other.has_special;
+  }
+
+  /*!
+   *  \return the sum rounded to nearest T, ties to even; the digits are
+   *          canonical after normalizing, so equal sums round identically
+   */
+  T get() const
+  {
+    if (has_special) {
+      return special;
+    }
+
+    ExactSum tmp(*this);
+    tmp.normalize();
+    const bool negative = tmp.digits[num_digits - 1] < 0;
+    if (negative) {
+      for (int k = 0; k < num_digits; ++k) {
+        tmp.digits[k] = -tmp.digits[k];
+      }
+      tmp.normalize();
+    }
+
+    int top = num_digits - 1;
+    while (top >= 0 && tmp.digits[top] == 0) {
+      --top;
+    }
+    if (top < 0) {
+      return T(0);
+    }
+
+    const std::uint64_t lead = static_cast<std::uint64_t>(tmp.digits[top]);
+    int lead_bits = 0;
+    while (lead_bits < 64 && (lead >> lead_bits) != 0) {
+      ++lead_bits;
+    }
+    const int lead_exponent = top * digit_bits + min_exponent + lead_bits - 1;
+    const int max_exponent = (1 << (Layout::exponent_bits - 1)) - 1;
+    if (lead_exponent > max_exponent) {
+      const T inf = std::numeric_limits<T>::infinity();
+      return negative ? -inf : inf;
+    }
+
+    // the top 64 bits, with everything below them folded into a sticky bit;
+    // below max_exponent only the last digit can reach 2^32
+    auto digit = [&](int k) -> std::uint64_t {
+      return k >= 0 ? static_cast<std::uint64_t>(tmp.digits[k]) : 0;
+    };
+    const std::uint64_t window = (digit(top) << (64 - lead_bits)) |
+                                 (digit(top - 1) << (32 - lead_bits)) |
+                                 (digit(top - 2) >> lead_bits);
+    bool sticky =
+        (digit(top - 2) & ((std::uint64_t(1) << lead_bits) - 1)) != 0;
+    for (int k = top - 3; k >= 0 && !sticky; --k) {
+      sticky = tmp.digits[k] != 0;
+    }
+
+    // round once, to the precision of T or to the subnormal spacing
+    const int precision = Layout::mantissa_bits + 1;
+    const int quantum = lead_exponent - precision + 1 > min_exponent
+                            ? lead_exponent - precision + 1
+                            : min_exponent;
+    const int drop = quantum - (lead_exponent - 63);
+    std::uint64_t kept = window >> drop;
+    const std::uint64_t rest = window & ((std::uint64_t(1) << drop) - 1);
+    const std::uint64_t half = std::uint64_t(1) << (drop - 1);
+    if (rest > half || (rest == half && (sticky || (kept & 1)))) {
+      ++kept;
+    }
+
+    // kept has at most precision + 1 bits, so this is exact
+    const T result = std::ldexp(static_cast<T>(kept), quantum);
+    return negative ? -result : result;
+  }
+};
+
+/*!
+ * \brief Folds b into a with reduce; for the Loc reducers, ties keep the
+ *        smallest index so the result does not depend on the fold order.
+ */
+template <typename T, typename Reduce>
+void combineReproducible(T &a, T const &b, Reduce reduce)
+{
+  reduce(a, b);
+}
+
+template <typename T, typename IndexType, bool doing_min, typename Reduce>
+typename std::enable_if<std::is_arithmetic<IndexType>::value>::type
+combineReproducible(ValueLoc<T, IndexType, doing_min> &a,
+                    ValueLoc<T, IndexType, doing_min> const &b,
+                    Reduce reduce)
+{
+  if (!(a < b) && !(b < a)) {
+    if (b.loc < a.loc) {
+      a.loc = b.loc;
+    }
+  } else {
+    reduce(a, b);
+  }
+}
+
+/*!
+ * \brief Value of a reproducible reducer.  Min, max and integer sums are
+ *        exact in any order, so they are kept as a plain T.
+ */
+template <typename T, typename Reduce, typename Enable = void>
+class ReproducibleValue
+{
+  static_assert(!std::is_floating_point<T>::value ||
+                    !std::is_same<Reduce, sum<T>>::value,
+                "Reproducible sums support float and double");
+
+  T value;
+
+public:
+  ReproducibleValue() : value() {}
+
+  explicit ReproducibleValue(T init) : value(init) {}
+
+  void add(T const &val) { combineReproducible(value, val, Reduce{}); }
+
+  void merge(ReproducibleValue const &other)
+  {
+    combineReproducible(value, other.value, Reduce{});
+  }
+
+  T get() const { return value; }
+};
+
+//! Floating-point sums are kept exactly and rounded once
+template <typename T>
+class ReproducibleValue<T,
+                        sum<T>,
+                        typename std::enable_if<
+                            is_exact_summable<T>::value>::type>
+{
+  ExactSum<T> value;
+
+public:
+  ReproducibleValue() = default;
+
+  explicit ReproducibleValue(T init) : value(init) {}
+
+  void add(T const &val) { value.add(val); }
+
+  void merge(ReproducibleValue const &other) { value.merge(other.value); }
+
+  T get() const { return value.get(); }
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Base combiner of the reproducible reducers.
+ *
+ *         Like BaseCombinable, copies point at the reducer they were made
+ *         from and fold their value into it when destroyed, but the value
+ *         is a ReproducibleValue, whose merges give the same result in any
+ *         order.  Back-ends that destroy copies concurrently fold them
+ *         themselves and clear parent.
+ *
+ ******************************************************************************
+ */
+template <typename T, typename Reduce, typename Derived>
+class BaseReproducible
+{
+protected:
+  using Accumulator = ReproducibleValue<T, Reduce>;
+
+  BaseReproducible const *parent = nullptr;
+  T identity;
+  Accumulator mutable my_data;
+
+public:
+  BaseReproducible(T init_val, T identity_ = T())
+      : identity{identity_}, my_data{init_val}
+  {
+  }
+
+  void reset(T init_val, T identity_)
+  {
+    identity = identity_;
+    my_data = Accumulator(init_val);
+  }
+
+  BaseReproducible(BaseReproducible const &other)
+      : parent{other.parent ? other.parent : &other},
+        identity{other.identity},
+        my_data{identity}
+  {
+  }
+
+  ~BaseReproducible()
+  {
+    if (parent) {
+      parent->my_data.merge(my_data);
+    }
+  }
+
+  void combine(T const &other) { my_data.add(other); }
+
+  /*!
+   *  \return the calculated reduced value
+   */
+  T get() const { return derived().get_combined(); }
+
+  T get_combined() const { return my_data.get(); }
+
+  /*!
+   *  \return reference to the accumulated value
+   */
+  Accumulator &accumulator() const { return my_data; }
+
+private:
+  // Convenience method for CRTP
+  const Derived &derived() const
+  {
+    return *(static_cast<const Derived *>(this));
+  }
+};
+
+}  // namespace detail
+
+}  // namespace reduce
+
+}  // namespace RAJA
+
+#endif /* RAJA_PATTERN_DETAIL_REDUCE_REPRODUCIBLE_HPP */
@@ -0,0 +1,420 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief  Internal header for the blocked scan engine shared by the
+ *         multithreaded host scan back-ends.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_DETAIL_SCAN_HPP
+#define RAJA_PATTERN_DETAIL_SCAN_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace scan
+{
+namespace detail
+{
+
+//! Unary operation of the plain (non-transform) scans
+struct ScanIdentity {
+  template <typename T>
+  RAJA_HOST_DEVICE constexpr T operator()(const T& value) const
+  {
+    return value;
+  }
+};
+
+/*!
+ * \brief First element of block pid when n elements are split into p
+ *        blocks whose sizes differ by at most one.
+ *
+ * Computed without forming n * pid, so it holds for any 64-bit n.
+ */
+RAJA_INLINE
+Index_type scanBlockFirst(Index_type n, Index_type p, Index_type pid)
+{
+  return (n / p) * pid + std::min(pid, n % p);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Reduce-then-scan over p contiguous blocks of [in, in + n).
+ *
+ *         Phase one reduces every block but the last into sums[pid].  Phase
+ *         two folds the sums of the preceding blocks (and init for exclusive
+ *         scans) into a carry and scans the block from in to out, applying
+ *         op to each input element as it is read.
+ *
+ *         The input is never copied: each element is read once per phase
+ *         and written once.  An element is read before its output is
+ *         written, so out may equal in.  The back-end runs phase one for
+ *         blocks [0, p - 1), synchronizes, then runs phase two for blocks
+ *         [0, p); blocks within a phase are independent.  sums must
+ *         hold p values of total_type.
+ *
+ ******************************************************************************
+ */
+template <bool Inclusive,
+          typename Value,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename UnaryFn>
+struct BlockScan {
+  using total_type = Value;
+
+  Iter in;
+  OutIter out;
+  BinFn f;
+  UnaryFn op;
+  Value init;
+  Index_type n;
+  Value* sums;
+
+  //! Phase one: total of block pid of p
+  void reduce(Index_type pid, Index_type p) const
+  {
+    const Index_type i0 = scanBlockFirst(n, p, pid);
+    const Index_type i1 = scanBlockFirst(n, p, pid + 1);
+    Value agg = op(*(in + i0));
+    for (Index_type i = i0 + 1; i < i1; ++i) {
+      agg = f(agg, op(*(in + i)));
+    }
+    sums[pid] = agg;
+  }
+
+  //! Phase two: scan block pid of p, seeded by the preceding totals
+  void scan(Index_type pid, Index_type p) const
+  {
+    const Index_type i0 = scanBlockFirst(n, p, pid);
+    const Index_type i1 = scanBlockFirst(n, p, pid + 1);
+    if (Inclusive) {
+      Index_type i = i0;
+      Value agg = op(*(in + i0));
+      if (pid > 0) {
+        Value carry = sums[0];
+        for (Index_type b = 1; b < pid; ++b) {
+          carry = f(carry, sums[b]);
+        }
+        agg = f(carry, agg);
+      }
+      *(out + i) = agg;
+      for (++i; i < i1; ++i) {
+        agg = f(agg, op(*(in + i)));
+        *(out + i) = agg;
+      }
+    } else {
+      Value agg = init;
+      for (Index_type b = 0; b < pid; ++b) {
+        agg = f(agg, sums[b]);
+      }
+      for (Index_type i = i0; i < i1; ++i) {
+        const Value t = op(*(in + i));
+        *(out + i) = agg;
+        agg = f(agg, t);
+      }
+    }
+  }
+};
+
+//! BlockScan over [in, in + n); the back-end sets sums before running it
+template <bool Inclusive,
+          typename Value,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename UnaryFn>
+BlockScan<Inclusive, Value, Iter, OutIter, BinFn, UnaryFn> makeBlockScan(
+    Iter in,
+    OutIter out,
+    Index_type n,
+    BinFn f,
+    UnaryFn op,
+    Value init)
+{
+  return BlockScan<Inclusive, Value, Iter, OutIter, BinFn, UnaryFn>{
+      in, out, f, op, init, n, nullptr};
+}
+
+//! Segment heads of a scan by key: a key that differs from its predecessor
+template <typename KeyIter, typename Pred>
+struct KeyHead {
+  KeyIter keys;
+  Pred pred;
+
+  bool operator()(Index_type i) const
+  {
+    return i == 0 || !pred(*(keys + (i - 1)), *(keys + i));
+  }
+};
+
+//! Segment heads of a flagged scan: a non-zero flag
+template <typename FlagIter>
+struct FlagHead {
+  FlagIter flags;
+
+  bool operator()(Index_type i) const { return i == 0 || *(flags + i); }
+};
+
+//! Total of one block of a segmented scan
+template <typename Value>
+struct SegmentTotal {
+  //! total of the elements after the last segment head in the block
+  Value value;
+  //! true if a segment starts in the block
+  bool head;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Reduce-then-scan over p contiguous blocks of [in, in + n) that
+ *         restarts at every index i with head(i).
+ *
+ *         Blocks are cut without regard to segment boundaries, so a range of
+ *         many short segments divides as evenly as a single long one.  A
+ *         block's total covers only the elements after its last segment
+ *         head, and the carry into a block stops at the nearest preceding
+ *         block that contains a head.  Exclusive scans start every segment
+ *         from init.  Driven by the back-end exactly like BlockScan.
+ *
+ ******************************************************************************
+ */
+template <bool Inclusive,
+          typename Value,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename HeadFn>
+struct SegmentedBlockScan {
+  using total_type = SegmentTotal<Value>;
+
+  Iter in;
+  OutIter out;
+  BinFn f;
+  HeadFn head;
+  Value init;
+  Index_type n;
+  total_type* sums;
+
+  //! Phase one: total of block pid of p
+  void reduce(Index_type pid, Index_type p) const
+  {
+    const Index_type i0 = scanBlockFirst(n, p, pid);
+    const Index_type i1 = scanBlockFirst(n, p, pid + 1);
+    bool has_head = head(i0);
+    Value agg = *(in + i0);
+    for (Index_type i = i0 + 1; i < i1; ++i) {
+      if (head(i)) {
+        has_head = true;
+        agg = *(in + i);
+      } else {
+        agg = f(agg, *(in + i));
+      }
+    }
+    sums[pid] = total_type{agg, has_head};
+  }
+
+  //! Phase two: scan block pid of p, seeded by the open segment's total
+  void scan(Index_type pid, Index_type p) const
+  {
+    const Index_type i0 = scanBlockFirst(n, p, pid);
+    const Index_type i1 = scanBlockFirst(n, p, pid + 1);
+    // block 0 always starts a segment, so the carry is seeded by a head
+    Value carry = init;
+    if (pid > 0 && !head(i0)) {
+      carry = sums[0].value;
+      for (Index_type b = 1; b < pid; ++b) {
+        carry = sums[b].head ? sums[b].value : f(carry, sums[b].value);
+      }
+    }
+    if (Inclusive) {
+      Value agg = carry;
+      for (Index_type i = i0; i < i1; ++i) {
+        agg = head(i) ? Value(*(in + i)) : f(agg, *(in + i));
+        *(out + i) = agg;
+      }
+    } else {
+      Value agg = head(i0) ? init : f(init, carry);
+      for (Index_type i = i0; i < i1; ++i) {
+        if (head(i)) {
+          agg = init;
+        }
+        const Value t = *(in + i);
+        *(out + i) = agg;
+        agg = f(agg, t);
+      }
+    }
+  }
+};
+
+//! SegmentedBlockScan over [in, in + n); the back-end sets sums
+template <bool Inclusive,
+          typename Value,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename HeadFn>
+SegmentedBlockScan<Inclusive, Value, Iter, OutIter, BinFn, HeadFn>
+makeSegmentedBlockScan(
+    Iter in, OutIter out, Index_type n, BinFn f, HeadFn head, Value init)
+{
+  return SegmentedBlockScan<Inclusive, Value, Iter, OutIter, BinFn, HeadFn>{
+      in, out, f, head, init, n, nullptr};
+}
+
+//! Output of compact for the elements that are not kept
+struct DiscardOutput {
+};
+
+template <typename OutIter, typename T>
+RAJA_INLINE void compactStore(OutIter out, Index_type pos, T&& value)
+{
+  *(out + pos) = std::forward<T>(value);
+}
+
+template <typename T>
+RAJA_INLINE void compactStore(DiscardOutput, Index_type, T&&)
+{
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Stable compaction of [in, in + n) over p contiguous blocks.
+ *
+ *         Element i is kept if sel(i).  Kept elements are written in order
+ *         to out_true and the others in order to out_false, which may be a
+ *         DiscardOutput.  Phase one counts the kept elements of each block
+ *         but the last; phase two writes each block at the count of the
+ *         blocks before it, and the last block stores the total in *count.
+ *         Driven by the back-end exactly like BlockScan.
+ *
+ ******************************************************************************
+ */
+template <typename Iter, typename OutTrue, typename OutFalse, typename SelectFn>
+struct CompactBlocks {
+  using total_type = Index_type;
+
+  Iter in;
+  OutTrue out_true;
+  OutFalse out_false;
+  SelectFn sel;
+  Index_type n;
+  Index_type* count;
+  total_type* sums;
+
+  //! Phase one: number of kept elements of block pid of p
+  void reduce(Index_type pid, Index_type p) const
+  {
+    const Index_type i0 = scanBlockFirst(n, p, pid);
+    const Index_type i1 = scanBlockFirst(n, p, pid + 1);
+    Index_type kept = 0;
+    for (Index_type i = i0; i < i1; ++i) {
+      kept += sel(i) ? 1 : 0;
+    }
+    sums[pid] = kept;
+  }
+
+  //! Phase two: write block pid of p after the kept elements before it
+  void scan(Index_type pid, Index_type p) const
+  {
+    const Index_type i0 = scanBlockFirst(n, p, pid);
+    const Index_type i1 = scanBlockFirst(n, p, pid + 1);
+    Index_type k = 0;
+    for (Index_type b = 0; b < pid; ++b) {
+      k += sums[b];
+    }
+    for (Index_type i = i0; i < i1; ++i) {
+      if (sel(i)) {
+        compactStore(out_true, k++, *(in + i));
+      } else {
+        compactStore(out_false, i - k, *(in + i));
+      }
+    }
+    if (pid == p - 1) {
+      *count = k;
+    }
+  }
+};
+
+//! CompactBlocks over [in, in + n); the back-end sets sums
+template <typename Iter, typename OutTrue, typename OutFalse, typename SelectFn>
+CompactBlocks<Iter, OutTrue, OutFalse, SelectFn> makeCompactBlocks(
+    Iter in,
+    OutTrue out_true,
+    OutFalse out_false,
+    Index_type n,
+    SelectFn sel,
+    Index_type* count)
+{
+  return CompactBlocks<Iter, OutTrue, OutFalse, SelectFn>{
+      in, out_true, out_false, sel, n, count, nullptr};
+}
+
+//! Selects element i of a copy_if, remove_if or partition
+template <typename Iter, typename Predicate>
+struct ValueSelect {
+  Iter in;
+  Predicate pred;
+
+  bool operator()(Index_type i) const { return pred(*(in + i)); }
+};
+
+//! Selects element i of a copy_if of the elements that fail pred
+template <typename Iter, typename Predicate>
+struct ValueReject {
+  Iter in;
+  Predicate pred;
+
+  bool operator()(Index_type i) const { return !pred(*(in + i)); }
+};
+
+//! Selects the first element of every run of equal elements
+template <typename Iter, typename BinaryPredicate>
+struct UniqueSelect {
+  Iter in;
+  BinaryPredicate eq;
+
+  bool operator()(Index_type i) const
+  {
+    return i == 0 || !eq(*(in + (i - 1)), *(in + i));
+  }
+};
+
+//! Selects every element
+struct SelectAll {
+  bool operator()(Index_type) const { return true; }
+};
+
+}  // namespace detail
+
+}  // namespace scan
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif /* RAJA_PATTERN_DETAIL_SCAN_HPP */
@@ -0,0 +1,591 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief  Internal header for the radix and merge sort engines shared by the
+ *         host sort back-ends.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_DETAIL_SORT_HPP
+#define RAJA_PATTERN_DETAIL_SORT_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/detail/scan.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+namespace detail
+{
+
+//! Ranges shorter than this are sorted by comparison even for integer keys
+constexpr Index_type radixSortMinSize = 2048;
+
+//! Smallest block worth sorting on its own thread before merging
+constexpr Index_type mergeSortMinBlock = 1024;
+
+//! Number of buckets of one radix digit
+constexpr Index_type radixBuckets = 256;
+
+/*!
+ * \brief True if keys of type Key ordered by Compare can be radix sorted,
+ *        which holds for integer keys under operators::less or greater.
+ */
+template <typename Key, typename Compare>
+struct is_radix_sortable : std::false_type {
+};
+
+template <typename Key>
+struct is_radix_sortable<Key, operators::less<Key>>
+    : std::integral_constant<bool,
+                             std::is_integral<Key>::value &&
+                                 !std::is_same<Key, bool>::value> {
+};
+
+template <typename Key>
+struct is_radix_sortable<Key, operators::greater<Key>>
+    : is_radix_sortable<Key, operators::less<Key>> {
+};
+
+template <typename Compare>
+struct is_descending : std::false_type {
+};
+
+template <typename Key>
+struct is_descending<operators::greater<Key>> : std::true_type {
+};
+
+//! Unsigned image of key whose unsigned order is the requested key order
+template <bool Descending, typename Key>
+typename std::make_unsigned<Key>::type radixImage(Key key)
+{
+  using U = typename std::make_unsigned<Key>::type;
+  U u = static_cast<U>(key);
+  if (std::is_signed<Key>::value) {
+    u = static_cast<U>(u ^ (U(1) << (sizeof(U) * CHAR_BIT - 1)));
+  }
+  return Descending ? static_cast<U>(~u) : u;
+}
+
+//! Stands in for the value range of a keys-only sort
+struct NoValues {
+};
+
+template <typename ValIter>
+struct ValueBuffer {
+  using value_type = typename std::iterator_traits<ValIter>::value_type;
+  using iterator = value_type*;
+
+  std::vector<value_type> data;
+
+  explicit ValueBuffer(Index_type n) : data(n) {}
+  iterator begin() { return data.data(); }
+};
+
+template <>
+struct ValueBuffer<NoValues> {
+  using iterator = NoValues;
+
+  explicit ValueBuffer(Index_type) {}
+  iterator begin() { return NoValues{}; }
+};
+
+template <typename Src, typename Dst>
+RAJA_INLINE void moveValue(Src src, Dst dst, Index_type from, Index_type to)
+{
+  *(dst + to) = std::move(*(src + from));
+}
+
+RAJA_INLINE void moveValue(NoValues, NoValues, Index_type, Index_type) {}
+
+//! Per-block histograms of the digit at shift, accumulated into counts
+template <bool Descending, typename ForBlocks, typename KeySrc>
+void radixCount(const ForBlocks& for_blocks,
+                Index_type p,
+                Index_type n,
+                int shift,
+                KeySrc ks,
+                Index_type* counts)
+{
+  for_blocks(p, [=](Index_type pid) {
+    Index_type* c = counts + pid * radixBuckets;
+    const Index_type i0 = scan::detail::scanBlockFirst(n, p, pid);
+    const Index_type i1 = scan::detail::scanBlockFirst(n, p, pid + 1);
+    for (Index_type i = i0; i < i1; ++i) {
+      ++c[(radixImage<Descending>(*(ks + i)) >> shift) & (radixBuckets - 1)];
+    }
+  });
+}
+
+/*!
+ * \brief One stable counting pass of an LSD radix sort on the digit at
+ *        shift, moving keys (and values) from the source to the destination
+ *        ranges.
+ *
+ *        counts holds the per-block digit histograms of the pass and is
+ *        turned into per-block scatter offsets here, so that every block
+ *        scatters its elements independently and in order.
+ */
+template <bool Descending,
+          typename ForBlocks,
+          typename KeySrc,
+          typename KeyDst,
+          typename ValSrc,
+          typename ValDst>
+void radixScatter(const ForBlocks& for_blocks,
+                  Index_type p,
+                  Index_type n,
+                  int shift,
+                  KeySrc ks,
+                  KeyDst kd,
+                  ValSrc vs,
+                  ValDst vd,
+                  Index_type* counts)
+{
+  Index_type offset = 0;
+  for (Index_type d = 0; d < radixBuckets; ++d) {
+    for (Index_type pid = 0; pid < p; ++pid) {
+      const Index_type c = counts[pid * radixBuckets + d];
+      counts[pid * radixBuckets + d] = offset;
+      offset += c;
+    }
+  }
+
+  for_blocks(p, [=](Index_type pid) {
+    Index_type* offs = counts + pid * radixBuckets;
+    const Index_type i0 = scan::detail::scanBlockFirst(n, p, pid);
+    const Index_type i1 = scan::detail::scanBlockFirst(n, p, pid + 1);
+    for (Index_type i = i0; i < i1; ++i) {
+      const Index_type d =
+          (radixImage<Descending>(*(ks + i)) >> shift) & (radixBuckets - 1);
+      const Index_type to = offs[d]++;
+      *(kd + to) = *(ks + i);
+      moveValue(vs, vd, i, to);
+    }
+  });
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  LSD radix sort of n integer keys (and their values), one byte per
+ *         pass, over p blocks run by for_blocks.
+ *
+ *         Each pass histograms the digit per block and then scatters every
+ *         block to its own offsets.  Passes in which all keys share the
+ *         digit are skipped.  The sort is stable.
+ *
+ ******************************************************************************
+ */
+template <bool Descending,
+          typename ForBlocks,
+          typename KeyIter,
+          typename ValIter>
+void radixSort(const ForBlocks& for_blocks,
+               Index_type p,
+               KeyIter keys,
+               ValIter vals,
+               Index_type n)
+{
+  using Key = typename std::iterator_traits<KeyIter>::value_type;
+
+  std::vector<Key> key_tmp(n);
+  ValueBuffer<ValIter> val_tmp(n);
+  std::vector<Index_type> counts(p * radixBuckets);
+  Index_type* const cnt = counts.data();
+
+  bool in_tmp = false;
+  for (int shift = 0; shift < static_cast<int>(sizeof(Key) * CHAR_BIT);
+       shift += 8) {
+
+    std::fill(counts.begin(), counts.end(), Index_type(0));
+    if (in_tmp) {
+      radixCount<Descending>(for_blocks, p, n, shift, key_tmp.data(), cnt);
+    } else {
+      radixCount<Descending>(for_blocks, p, n, shift, keys, cnt);
+    }
+
+    // skip the pass if every key has the same digit
+    bool trivial = false;
+    for (Index_type d = 0; d < radixBuckets && !trivial; ++d) {
+      Index_type total = 0;
+      for (Index_type pid = 0; pid < p; ++pid) {
+        total += counts[pid * radixBuckets + d];
+      }
+      trivial = (total == n);
+    }
+    if (trivial) {
+      continue;
+    }
+
+    if (in_tmp) {
+      radixScatter<Descending>(for_blocks,
+                               p,
+                               n,
+                               shift,
+                               key_tmp.data(),
+                               keys,
+                               val_tmp.begin(),
+                               vals,
+                               cnt);
+    } else {
+      radixScatter<Descending>(for_blocks,
+                               p,
+                               n,
+                               shift,
+                               keys,
+                               key_tmp.data(),
+                               vals,
+                               val_tmp.begin(),
+                               cnt);
+    }
+    in_tmp = !in_tmp;
+  }
+
+  if (in_tmp) {
+    Key* const kt = key_tmp.data();
+    auto vt = val_tmp.begin();
+    for_blocks(p, [=](Index_type pid) {
+      const Index_type i0 = scan::detail::scanBlockFirst(n, p, pid);
+      const Index_type i1 = scan::detail::scanBlockFirst(n, p, pid + 1);
+      for (Index_type i = i0; i < i1; ++i) {
+        *(keys + i) = *(kt + i);
+        moveValue(vt, vals, i, i);
+      }
+    });
+  }
+}
+
+/*!
+ * \brief First element of the merge of a[0, na) and b[0, nb) that lands at
+ *        output position d is a[i] or b[d - i]; returns i.
+ *
+ *        Ties are taken from a first, which keeps the merge stable.
+ */
+template <typename IterA, typename IterB, typename Compare>
+Index_type mergeCoRank(Index_type d,
+                       IterA a,
+                       Index_type na,
+                       IterB b,
+                       Index_type nb,
+                       Compare comp)
+{
+  Index_type lo = std::max(Index_type(0), d - nb);
+  Index_type hi = std::min(d, na);
+  while (lo < hi) {
+    const Index_type i = lo + (hi - lo) / 2;
+    const Index_type j = d - i;
+    // a[i] precedes b[j - 1], so more of a belongs in the first d outputs
+    if (j > 0 && !comp(*(b + (j - 1)), *(a + i))) {
+      lo = i + 1;
+    } else {
+      hi = i;
+    }
+  }
+  return lo;
+}
+
+/*!
+ * \brief Merge adjacent runs of w blocks each from src into dst.
+ *
+ *        Every merge is cut into equal pieces of output by co-ranking, so
+ *        the last rounds, with few long runs, still use all p blocks.
+ */
+template <typename ForBlocks, typename Src, typename Dst, typename Compare>
+void mergeRound(const ForBlocks& for_blocks,
+                Index_type p,
+                Index_type w,
+                Index_type n,
+                Src src,
+                Dst dst,
+                Compare comp)
+{
+  const Index_type pairs = (p + 2 * w - 1) / (2 * w);
+  const Index_type pieces = std::max(Index_type(1), p / pairs);
+  for_blocks(pairs * pieces, [=](Index_type task) {
+    const Index_type k = task / pieces;
+    const Index_type piece = task % pieces;
+    const Index_type a0 =
+        scan::detail::scanBlockFirst(n, p, std::min(2 * k * w, p));
+    const Index_type a1 =
+        scan::detail::scanBlockFirst(n, p, std::min(2 * k * w + w, p));
+    const Index_type b1 =
+        scan::detail::scanBlockFirst(n, p, std::min(2 * k * w + 2 * w, p));
+    const Index_type na = a1 - a0;
+    const Index_type nb = b1 - a1;
+    const Index_type d0 = scan::detail::scanBlockFirst(na + nb, pieces, piece);
+    const Index_type d1 =
+        scan::detail::scanBlockFirst(na + nb, pieces, piece + 1);
+    const Index_type i0 = mergeCoRank(d0, src + a0, na, src + a1, nb, comp);
+    const Index_type i1 = mergeCoRank(d1, src + a0, na, src + a1, nb, comp);
+    std::merge(src + a0 + i0,
+               src + a0 + i1,
+               src + a1 + (d0 - i0),
+               src + a1 + (d1 - i1),
+               dst + a0 + d0,
+               comp);
+  });
+}
+
+template <typename Iter, typename Compare>
+void blockSort(std::false_type, Iter begin, Iter end, Compare comp)
+{
+  std::sort(begin, end, comp);
+}
+
+template <typename Iter, typename Compare>
+void blockSort(std::true_type, Iter begin, Iter end, Compare comp)
+{
+  std::stable_sort(begin, end, comp);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Merge sort of [begin, begin + n) over up to p blocks run by
+ *         for_blocks.
+ *
+ *         Each block is sorted on its own, then runs are merged pairwise
+ *         in log2(p) rounds that alternate between the data and a buffer.
+ *         The merges are stable, so the sort is stable if Stable is set.
+ *
+ ******************************************************************************
+ */
+template <bool Stable, typename ForBlocks, typename Iter, typename Compare>
+void mergeSort(const ForBlocks& for_blocks,
+               Index_type p,
+               Iter begin,
+               Index_type n,
+               Compare comp)
+{
+  using T = typename std::iterator_traits<Iter>::value_type;
+
+  p = std::max(Index_type(1), std::min(p, n / mergeSortMinBlock));
+  for_blocks(p, [=](Index_type pid) {
+    blockSort(std::integral_constant<bool, Stable>{},
+              begin + scan::detail::scanBlockFirst(n, p, pid),
+              begin + scan::detail::scanBlockFirst(n, p, pid + 1),
+              comp);
+  });
+  if (p == 1) {
+    return;
+  }
+
+  std::vector<T> tmp(n);
+  T* const buf = tmp.data();
+  bool in_tmp = false;
+  for (Index_type w = 1; w < p; w *= 2) {
+    if (in_tmp) {
+      mergeRound(for_blocks, p, w, n, buf, begin, comp);
+    } else {
+      mergeRound(for_blocks, p, w, n, begin, buf, comp);
+    }
+    in_tmp = !in_tmp;
+  }
+
+  if (in_tmp) {
+    for_blocks(p, [=](Index_type pid) {
+      const Index_type i0 = scan::detail::scanBlockFirst(n, p, pid);
+      const Index_type i1 = scan::detail::scanBlockFirst(n, p, pid + 1);
+      std::move(buf + i0, buf + i1, begin + i0);
+    });
+  }
+}
+
+//! Orders (key, value) pairs by key alone
+template <typename Compare>
+struct PairKeyCompare {
+  Compare comp;
+
+  template <typename Pair>
+  bool operator()(const Pair& lhs, const Pair& rhs) const
+  {
+    return comp(lhs.first, rhs.first);
+  }
+};
+
+template <bool Stable, typename ForBlocks, typename Iter, typename Compare>
+void sortKeys(std::false_type,
+              const ForBlocks& for_blocks,
+              Index_type p,
+              Iter begin,
+              Index_type n,
+              Compare comp)
+{
+  mergeSort<Stable>(for_blocks, p, begin, n, comp);
+}
+
+template <bool Stable, typename ForBlocks, typename Iter, typename Compare>
+void sortKeys(std::true_type,
+              const ForBlocks& for_blocks,
+              Index_type p,
+              Iter begin,
+              Index_type n,
+              Compare comp)
+{
+  if (n < radixSortMinSize) {
+    mergeSort<Stable>(for_blocks, p, begin, n, comp);
+  } else {
+    radixSort<is_descending<Compare>::value>(
+        for_blocks, p, begin, NoValues{}, n);
+  }
+}
+
+template <bool Stable,
+          typename ForBlocks,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+void sortPairs(std::false_type,
+               const ForBlocks& for_blocks,
+               Index_type p,
+               KeyIter keys,
+               ValIter vals,
+               Index_type n,
+               Compare comp)
+{
+  using Key = typename std::iterator_traits<KeyIter>::value_type;
+  using Val = typename std::iterator_traits<ValIter>::value_type;
+  using Pair = std::pair<Key, Val>;
+
+  // sort the pairs together, then write them back
+  std::vector<Pair> zipped(n);
+  Pair* const z = zipped.data();
+  const Index_type pz = std::max(Index_type(1), std::min(p, n));
+  for_blocks(pz, [=](Index_type pid) {
+    const Index_type i0 = scan::detail::scanBlockFirst(n, pz, pid);
+    const Index_type i1 = scan::detail::scanBlockFirst(n, pz, pid + 1);
+    for (Index_type i = i0; i < i1; ++i) {
+      z[i] = Pair(std::move(*(keys + i)), std::move(*(vals + i)));
+    }
+  });
+
+  mergeSort<Stable>(for_blocks, p, z, n, PairKeyCompare<Compare>{comp});
+
+  for_blocks(pz, [=](Index_type pid) {
+    const Index_type i0 = scan::detail::scanBlockFirst(n, pz, pid);
+    const Index_type i1 = scan::detail::scanBlockFirst(n, pz, pid + 1);
+    for (Index_type i = i0; i < i1; ++i) {
+      *(keys + i) = std::move(z[i].first);
+      *(vals + i) = std::move(z[i].second);
+    }
+  });
+}
+
+template <bool Stable,
+          typename ForBlocks,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+void sortPairs(std::true_type,
+               const ForBlocks& for_blocks,
+               Index_type p,
+               KeyIter keys,
+               ValIter vals,
+               Index_type n,
+               Compare comp)
+{
+  if (n < radixSortMinSize) {
+    sortPairs<Stable>(std::false_type{}, for_blocks, p, keys, vals, n, comp);
+  } else {
+    radixSort<is_descending<Compare>::value>(for_blocks, p, keys, vals, n);
+  }
+}
+
+/*!
+ * \brief Sort [begin, end) with p-way parallelism provided by for_blocks,
+ *        which runs body(i) for every i in [0, m) when called as
+ *        for_blocks(m, body).
+ */
+template <bool Stable, typename ForBlocks, typename Iter, typename Compare>
+void sortEngine(const ForBlocks& for_blocks,
+                Index_type p,
+                Iter begin,
+                Iter end,
+                Compare comp)
+{
+  using Key = typename std::iterator_traits<Iter>::value_type;
+  const Index_type n = end - begin;
+  if (n < 2) {
+    return;
+  }
+  sortKeys<Stable>(is_radix_sortable<Key, Compare>{},
+                   for_blocks,
+                   p,
+                   begin,
+                   n,
+                   comp);
+}
+
+//! Sort keys [keys_begin, keys_end) and permute vals with them
+template <bool Stable,
+          typename ForBlocks,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+void sortPairsEngine(const ForBlocks& for_blocks,
+                     Index_type p,
+                     KeyIter keys_begin,
+                     KeyIter keys_end,
+                     ValIter vals,
+                     Compare comp)
+{
+  using Key = typename std::iterator_traits<KeyIter>::value_type;
+  const Index_type n = keys_end - keys_begin;
+  if (n < 2) {
+    return;
+  }
+  sortPairs<Stable>(is_radix_sortable<Key, Compare>{},
+                    for_blocks,
+                    p,
+                    keys_begin,
+                    vals,
+                    n,
+                    comp);
+}
+
+//! for_blocks of the sequential back-ends
+struct SerialForBlocks {
+  template <typename Body>
+  void operator()(Index_type m, Body body) const
+  {
+    for (Index_type i = 0; i < m; ++i) {
+      body(i);
+    }
+  }
+};
+
+}  // namespace detail
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif /* RAJA_PATTERN_DETAIL_SORT_HPP */
@@ -0,0 +1,143 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing the back-end independent pieces of the
+*          functional transform-reduce.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_DETAIL_TRANSFORM_REDUCE_HPP
+#define RAJA_PATTERN_DETAIL_TRANSFORM_REDUCE_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/detail/scan.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace transform_reduce
+{
+namespace detail
+{
+
+/*!
+ * \brief Partial result of one block, alone on its cache line so that the
+ *        threads filling neighbouring slots do not share lines.
+ */
+template <typename T>
+struct alignas(64) BlockPartial {
+  T value;
+  bool valid;
+};
+
+/*!
+ * \brief Reduces f(i) over block pid of p of [0, n) into partial; an empty
+ *        block leaves partial invalid.  Starting from the first element
+ *        rather than an identity lets any associative op be used.
+ */
+template <typename T, typename BinFn, typename Fn>
+void reduceBlock(Index_type n,
+                 Index_type p,
+                 Index_type pid,
+                 BinFn op,
+                 Fn f,
+                 BlockPartial<T>& partial)
+{
+  const Index_type i0 = scan::detail::scanBlockFirst(n, p, pid);
+  const Index_type i1 = scan::detail::scanBlockFirst(n, p, pid + 1);
+  partial.valid = i0 < i1;
+  if (!partial.valid) {
+    return;
+  }
+  T acc = f(i0);
+  for (Index_type i = i0 + 1; i < i1; ++i) {
+    acc = op(acc, f(i));
+  }
+  partial.value = acc;
+}
+
+//! Folds the valid partials into init in block order
+template <typename T, typename BinFn>
+T combinePartials(T init,
+                  BinFn op,
+                  const BlockPartial<T>* partials,
+                  Index_type p)
+{
+  for (Index_type pid = 0; pid < p; ++pid) {
+    if (partials[pid].valid) {
+      init = op(init, partials[pid].value);
+    }
+  }
+  return init;
+}
+
+//! Element i of a transform_reduce over one range
+template <typename T, typename Iter, typename UnaryFn>
+struct UnaryTransform {
+  Iter in;
+  UnaryFn f;
+
+  T operator()(Index_type i) const { return f(*(in + i)); }
+};
+
+//! Element i of a transform_reduce over two ranges
+template <typename T, typename Iter1, typename Iter2, typename BinaryFn>
+struct BinaryTransform {
+  Iter1 in1;
+  Iter2 in2;
+  BinaryFn f;
+
+  T operator()(Index_type i) const { return f(*(in1 + i), *(in2 + i)); }
+};
+
+/*!
+ * \brief True if op is one of the operators OpenMP can reduce natively on
+ *        T, so back-ends with a reduction clause can use it.
+ */
+template <typename T, typename BinFn>
+struct is_native_reduction : std::false_type {
+};
+
+template <typename T>
+struct is_native_reduction<T, operators::plus<T>> : std::is_arithmetic<T> {
+};
+
+template <typename T>
+struct is_native_reduction<T, operators::multiplies<T>>
+    : std::is_arithmetic<T> {
+};
+
+template <typename T>
+struct is_native_reduction<T, operators::minimum<T>> : std::is_arithmetic<T> {
+};
+
+template <typename T>
+struct is_native_reduction<T, operators::maximum<T>> : std::is_arithmetic<T> {
+};
+
+}  // namespace detail
+
+}  // namespace transform_reduce
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif /* RAJA_PATTERN_DETAIL_TRANSFORM_REDUCE_HPP */
@@ -58,6 +58,8 @@
 #include <iterator>
 #include <type_traits>
 
+#include "camp/tuple.hpp"
+
 #include "RAJA/internal/Iterators.hpp"
 
 #include "RAJA/policy/PolicyBase.hpp"
@@ -75,11 +77,17 @@
 #include "RAJA/policy/sequential/forall.hpp"
 
 #include "RAJA/pattern/detail/forall.hpp"
+#include "RAJA/pattern/detail/forall_param.hpp"
 #include "RAJA/pattern/detail/privatizer.hpp"
 
 #include "RAJA/internal/get_platform.hpp"
+#include "RAJA/util/AsyncEvent.hpp"
 #include "RAJA/util/plugins.hpp"
 
+#if defined(RAJA_ENABLE_THREADS)
+#include "RAJA/policy/threads/ThreadPool.hpp"
+#endif
+
 
 namespace RAJA
 {
@@ -228,12 +236,15 @@ RAJA_INLINE void forall_Icount(ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>,
   using RAJA::internal::trigger_updates_before;
   auto body = trigger_updates_before(loop_body);
 
-  // no need for icount variant here
+  // no need for icount variant here; the index set outlives the loop, so
+  // it is captured by pointer rather than copied with each segment body
+  auto const* iset_ptr = &iset;
   wrap::forall(SegmentIterPolicy(), iset, [=](int segID) {
-    iset.segmentCall(segID,
-                     detail::CallForallIcount(iset.getStartingIcount(segID)),
-                     SegmentExecPolicy(),
-                     body);
+    iset_ptr->segmentCall(
+        segID,
+        detail::CallForallIcount(iset_ptr->getStartingIcount(segID)),
+        SegmentExecPolicy(),
+        body);
   });
 }
 
@@ -249,8 +260,14 @@ RAJA_INLINE void forall(ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>,
   using RAJA::internal::trigger_updates_before;
   auto body = trigger_updates_before(loop_body);
 
+  // the index set outlives the loop, so it is captured by pointer rather
+  // than copied with each segment body
+  auto const* iset_ptr = &iset;
   wrap::forall(SegmentIterPolicy(), iset, [=](int segID) {
-    iset.segmentCall(segID, detail::CallForall{}, SegmentExecPolicy(), body);
+    iset_ptr->segmentCall(segID,
+                          detail::CallForall{},
+                          SegmentExecPolicy(),
+                          body);
   });
 }
 
@@ -483,6 +500,507 @@ RAJA_INLINE void forall_Icount(Args&&... args)
   util::callPostLaunchPlugins(context);
 }
 
+//
+//////////////////////////////////////////////////////////////////////
+//
+// Asynchronous iteration.
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+namespace detail
+{
+
+/// Runs a whole forall when invoked; used to launch it as a single task
+template <typename ExecutionPolicy, typename Container, typename LoopBody>
+struct AsyncForallLauncher {
+  typename std::decay<ExecutionPolicy>::type policy;
+  typename std::decay<Container>::type container;
+  typename std::decay<LoopBody>::type body;
+
+  void operator()(Index_type, Index_type) const
+  {
+    wrap::forall(policy, container, body);
+  }
+
+  void operator()() const { wrap::forall(policy, container, body); }
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Asynchronous forall for policies without a native implementation.
+ *
+ *        When the threads back-end is enabled, host loops are handed to the
+ *        thread pool as a single task, which then runs the loop with the
+ *        requested policy.  Otherwise, in builds with OpenMP or TBB, each
+ *        host loop runs on a std::thread of its own, which starts its own
+ *        OpenMP team or joins the TBB workers.  In other builds the loop
+ *        completes before this returns and the returned event is already
+ *        complete.
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy, typename Container, typename LoopBody>
+RAJA_INLINE AsyncEvent forall_async_impl(const ExecutionPolicy& p,
+                                         Container&& c,
+                                         LoopBody&& loop_body)
+{
+#if defined(RAJA_ENABLE_THREADS)
+  if (get_platform<ExecutionPolicy>::value == Platform::host) {
+    using launcher_type =
+        AsyncForallLauncher<ExecutionPolicy, Container, LoopBody>;
+    return threads::ThreadPool::getInstance().parallelForAsync(
+        1,
+        1,
+        launcher_type{p,
+                      std::forward<Container>(c),
+                      std::forward<LoopBody>(loop_body)});
+  }
+#elif defined(RAJA_ENABLE_OPENMP) || defined(RAJA_ENABLE_TBB)
+  if (get_platform<ExecutionPolicy>::value == Platform::host) {
+    using launcher_type =
+        AsyncForallLauncher<ExecutionPolicy, Container, LoopBody>;
+    return AsyncEvent(std::make_shared<DedicatedThreadAsyncState>(
+        launcher_type{p,
+                      std::forward<Container>(c),
+                      std::forward<LoopBody>(loop_body)}));
+  }
+#endif
+  wrap::forall(p,
+               std::forward<Container>(c),
+               std::forward<LoopBody>(loop_body));
+  return AsyncEvent{};
+}
+
+}  // namespace detail
+
+namespace wrap
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Generic asynchronous dispatch with a value-based policy
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy, typename Container, typename LoopBody>
+RAJA_INLINE AsyncEvent forall_async(ExecutionPolicy&& p,
+                                    Container&& c,
+                                    LoopBody&& loop_body)
+{
+  using RAJA::internal::trigger_updates_before;
+  auto body = trigger_updates_before(loop_body);
+
+  using detail::forall_async_impl;
+  return forall_async_impl(std::forward<ExecutionPolicy>(p),
+                           std::forward<Container>(c),
+                           std::move(body));
+}
+
+}  // end namespace wrap
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Launch a forall without waiting for it to complete.
+ *
+ *        Returns an AsyncEvent whose wait() blocks until every iteration has
+ *        executed.  Several independent loops may be launched before any of
+ *        them is waited on, letting them share the machine.
+ *
+ *        The range and loop body are copied into the launch, but any data
+ *        the body refers to must stay valid until the event completes.
+ *        Policies of the threads back-end launch natively; other host
+ *        policies run as a single task on the thread pool.  When the threads
+ *        back-end is disabled they run on a thread of their own in OpenMP
+ *        and TBB builds, and synchronously otherwise.
+ *
+ *        Pre-launch plugins run at the launch.  Post-launch plugins run when
+ *        the loop is first observed complete, by wait(), a test() that
+ *        returns true, or the destruction of the last copy of the event, on
+ *        the thread that observes it.
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy, typename... Args>
+RAJA_INLINE AsyncEvent forall_async(Args&&... args)
+{
+  util::PluginContext context{util::make_context<ExecutionPolicy>()};
+  util::callPreLaunchPlugins(context);
+
+  AsyncEvent event =
+      wrap::forall_async(ExecutionPolicy(), std::forward<Args>(args)...);
+
+  event.onCompletion([context]() { util::callPostLaunchPlugins(context); });
+
+  return event;
+}
+
+//
+//////////////////////////////////////////////////////////////////////
+//
+// Fused iteration of several loop bodies.
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+//! Default number of iterations per chunk in RAJA::forall_fused
+constexpr size_t fused_chunk_size = 1024;
+
+namespace detail
+{
+
+/// Runs every body over one chunk of iterations, in order
+template <typename Iterator, typename... Bodies>
+struct FusedChunkBody {
+  Iterator begin_it;
+  Index_type len;
+  Index_type chunk_size;
+  camp::tuple<Bodies...> bodies;
+
+  template <typename ChunkIndex>
+  RAJA_HOST_DEVICE void operator()(ChunkIndex chunk) const
+  {
+    const Index_type first = static_cast<Index_type>(chunk) * chunk_size;
+    const Index_type last =
+        (first + chunk_size < len) ? first + chunk_size : len;
+    run(camp::make_idx_seq_t<sizeof...(Bodies)>{}, first, last);
+  }
+
+  template <camp::idx_t... Is>
+  RAJA_HOST_DEVICE void run(camp::idx_seq<Is...>,
+                            Index_type first,
+                            Index_type last) const
+  {
+    // braced initializers are evaluated in order
+    int order[] = {0, (runBody(camp::get<Is>(bodies), first, last), 0)...};
+    RAJA_UNUSED_VAR(order);
+  }
+
+  template <typename Body>
+  RAJA_HOST_DEVICE void runBody(Body const& body,
+                                Index_type first,
+                                Index_type last) const
+  {
+    for (Index_type i = first; i < last; ++i) {
+      body(begin_it[i]);
+    }
+  }
+};
+
+}  // namespace detail
+
+namespace wrap
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Generic fused dispatch over containers with a value-based policy
+ *
+ ******************************************************************************
+ */
+template <size_t ChunkSize,
+          typename ExecutionPolicy,
+          typename Container,
+          typename... Bodies>
+RAJA_INLINE concepts::enable_if<type_traits::is_range<Container>>
+forall_fused(ExecutionPolicy&& p, Container&& c, Bodies&&... bodies)
+{
+  static_assert(ChunkSize > 0, "forall_fused needs a positive chunk size");
+
+  using RAJA::internal::trigger_updates_before;
+  using std::begin;
+  using std::distance;
+  using std::end;
+  auto begin_it = begin(c);
+  const Index_type len = distance(begin_it, end(c));
+  const Index_type chunk_size = static_cast<Index_type>(ChunkSize);
+  const Index_type num_chunks = (len + chunk_size - 1) / chunk_size;
+
+  detail::FusedChunkBody<decltype(begin_it), camp::decay<Bodies>...> fused{
+      begin_it,
+      len,
+      chunk_size,
+      camp::tuple<camp::decay<Bodies>...>(trigger_updates_before(bodies)...)};
+
+  forall_impl(std::forward<ExecutionPolicy>(p),
+              TypedRangeSegment<Index_type>(0, num_chunks),
+              fused);
+}
+
+}  // end namespace wrap
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Execute several loop bodies over one iteration space in a single
+ *        launch.
+ *
+ *        The range is split into chunks of ChunkSize iterations and the
+ *        chunks are distributed by ExecutionPolicy.  For each chunk, every
+ *        body runs over the whole chunk before the next body starts, so data
+ *        shared by the bodies is still in cache when the later bodies run.
+ *
+ *        A body may use values written by earlier bodies at the same index,
+ *        but not at other indices: unlike a sequence of forall calls, there
+ *        is no barrier between the bodies.  Bodies may use reducers.
+ *
+ * Usage example:
+ *
+ * \verbatim
+ *
+ *   RAJA::forall_fused<RAJA::omp_parallel_for_exec>(
+ *       RAJA::RangeSegment(0, N),
+ *       [=](int i) { flux[i] = ...; },
+ *       [=](int i) { u[i] += dt * flux[i]; },
+ *       [=](int i) { norm += u[i] * u[i]; });
+ *
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy,
+          size_t ChunkSize = fused_chunk_size,
+          typename Container,
+          typename... Bodies>
+RAJA_INLINE void forall_fused(Container&& c, Bodies&&... bodies)
+{
+  util::PluginContext context{util::make_context<ExecutionPolicy>()};
+  util::callPreLaunchPlugins(context);
+
+  wrap::forall_fused<ChunkSize>(ExecutionPolicy(),
+                                std::forward<Container>(c),
+                                std::forward<Bodies>(bodies)...);
+
+  util::callPostLaunchPlugins(context);
+}
+
+//
+//////////////////////////////////////////////////////////////////////
+//
+// Iteration over whole sub-ranges.
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+namespace wrap
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Generic chunked dispatch over a range segment with a value-based
+ *        policy
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy,
+          typename StorageT,
+          typename DiffT,
+          typename LoopBody>
+RAJA_INLINE void forall_chunked(ExecutionPolicy&& p,
+                                TypedRangeSegment<StorageT, DiffT> const& seg,
+                                LoopBody&& loop_body)
+{
+  if (seg.size() <= 0) return;
+
+  using RAJA::internal::trigger_updates_before;
+  auto body = trigger_updates_before(loop_body);
+
+  forall_chunked_impl(std::forward<ExecutionPolicy>(p), seg, body);
+}
+
+}  // end namespace wrap
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Execute a loop body once per chunk of a range segment.
+ *
+ *        The body receives a TypedRangeSegment of the same type as the range
+ *        and runs its own loop over it.  Chunks are contiguous, non-empty,
+ *        disjoint and cover the range; each is the block of iterations the policy
+ *        assigns to one thread at a time, so setup such as scratch buffers,
+ *        table lookups or local accumulators is done once per chunk rather
+ *        than once per iteration.  The policy sets the grain: sequential
+ *        policies pass the whole range, omp_for_exec and
+ *        omp_parallel_for_exec one block per thread, and policies with a
+ *        chunk or grain size pass chunks of that size.
+ *
+ *        Supported policies are seq_exec, loop_exec, simd_exec, the OpenMP
+ *        for, static, dynamic and parallel policies, and the TBB and
+ *        threads for policies.
+ *
+ * Usage example:
+ *
+ * \verbatim
+ *
+ *   RAJA::forall_chunked<RAJA::omp_parallel_for_dynamic<4096>>(
+ *       RAJA::RangeSegment(0, N), [=](RAJA::RangeSegment chunk) {
+ *     double scratch[64];
+ *     for (auto i : chunk) {
+ *       ...
+ *     }
+ *   });
+ *
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy, typename... Args>
+RAJA_INLINE void forall_chunked(Args&&... args)
+{
+  util::PluginContext context{util::make_context<ExecutionPolicy>()};
+  util::callPreLaunchPlugins(context);
+
+  wrap::forall_chunked(ExecutionPolicy(), std::forward<Args>(args)...);
+
+  util::callPostLaunchPlugins(context);
+}
+
+//
+//////////////////////////////////////////////////////////////////////
+//
+// Iteration with reductions passed as parameters.
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Reduction parameter of RAJA::forall_param combining into *target
+ *        with the binary operator Op, e.g. Reduce<operators::plus>(&sum).
+ *
+ *        Op is one of the RAJA::operators with an identity, such as plus,
+ *        multiplies, minimum or maximum.
+ *
+ ******************************************************************************
+ */
+template <template <typename...> class Op, typename T>
+RAJA_INLINE detail::ReduceParam<T, Op> Reduce(T* target)
+{
+  return detail::ReduceParam<T, Op>{target};
+}
+
+namespace wrap
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Generic dispatch of forall_param over containers with a
+ *        value-based policy
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy,
+          typename Container,
+          typename LoopBody,
+          typename... Params>
+RAJA_INLINE concepts::enable_if<type_traits::is_range<Container>>
+forall_param(ExecutionPolicy&& p,
+             Container&& c,
+             detail::ForallParamPack<Params...> const& params,
+             LoopBody&& loop_body)
+{
+  using RAJA::internal::trigger_updates_before;
+  auto body = trigger_updates_before(loop_body);
+
+  forall_param_impl(std::forward<ExecutionPolicy>(p),
+                    std::forward<Container>(c),
+                    params,
+                    body);
+}
+
+}  // end namespace wrap
+
+namespace detail
+{
+
+//! Splits the arguments of forall_param into its parameters and loop body
+template <typename ExecutionPolicy,
+          typename Container,
+          typename Args,
+          camp::idx_t... Params>
+RAJA_INLINE void forall_param_split(ExecutionPolicy&& p,
+                                    Container&& c,
+                                    Args&& args,
+                                    camp::idx_seq<Params...>)
+{
+  using pack_type = ForallParamPack<
+      camp::decay<camp::tuple_element_t<Params, camp::decay<Args>>>...>;
+
+  wrap::forall_param(
+      std::forward<ExecutionPolicy>(p),
+      std::forward<Container>(c),
+      pack_type{camp::make_tuple(camp::get<Params>(args)...)},
+      camp::get<sizeof...(Params)>(args));
+}
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Execute a loop whose reductions are passed as parameters.
+ *
+ *        Each parameter, such as Reduce<operators::plus>(&sum), adds an
+ *        argument to the loop body: a reference to an accumulator private to
+ *        the executing thread, which starts at the identity of the operator.
+ *        After the loop, the accumulators of all threads are combined into
+ *        the targets, so sum is added to rather than overwritten.
+ *
+ *        Unlike reducer objects, nothing is registered when the loop body is
+ *        copied for a thread, and the back-ends combine the accumulators in
+ *        their own way: OpenMP uses a reduction clause for a single sum,
+ *        product, min or max of an arithmetic type, TBB a parallel_reduce.
+ *        The loop body is not copied per thread, so it should not capture
+ *        reducer objects.
+ *
+ *        Supported policies are seq_exec, loop_exec, simd_exec, the OpenMP
+ *        parallel for policies, and the TBB and threads for policies.
+ *
+ * Usage example:
+ *
+ * \verbatim
+ *
+ *   double sum = 0.0;
+ *   double vmax = -DBL_MAX;
+ *
+ *   RAJA::forall_param<RAJA::omp_parallel_for_exec>(
+ *       RAJA::RangeSegment(0, N),
+ *       RAJA::Reduce<RAJA::operators::plus>(&sum),
+ *       RAJA::Reduce<RAJA::operators::maximum>(&vmax),
+ *       [=](RAJA::Index_type i, double& s, double& m) {
+ *     s += a[i];
+ *     m = RAJA_MAX(m, a[i]);
+ *   });
+ *
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy, typename Container, typename... Args>
+RAJA_INLINE void forall_param(Container&& c, Args&&... args)
+{
+  static_assert(sizeof...(Args) > 0, "forall_param needs a loop body");
+
+  util::PluginContext context{util::make_context<ExecutionPolicy>()};
+  util::callPreLaunchPlugins(context);
+
+  detail::forall_param_split(ExecutionPolicy(),
+                             std::forward<Container>(c),
+                             camp::forward_as_tuple(
+                                 std::forward<Args>(args)...),
+                             camp::make_idx_seq_t<sizeof...(Args) - 1>{});
+
+  util::callPostLaunchPlugins(context);
+}
+
 namespace detail
 {
 
@@ -0,0 +1,211 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA histogram and reduce-by-key
+*          declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_histogram_HPP
+#define RAJA_histogram_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "camp/concepts.hpp"
+#include "camp/helpers.hpp"
+
+#include "RAJA/pattern/detail/histogram.hpp"
+#include "RAJA/pattern/scan.hpp"
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+******************************************************************************
+*
+* \brief  histogram execution pattern
+*
+*         Adds one to bins[k] for every key k in [begin, end), like an
+*         atomicAdd into a shared bin array but without contention: bins
+*         are privatized per thread when they are few, and the keys are
+*         sorted and summed run by run when they are many.
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of key range
+* \param[in] end Pointer or Random-Access Iterator to end of key range
+*(exclusive)
+* \param[in,out] bins Pointer or Random-Access Iterator to the bins
+* \param[in] num_bins number of bins; every key must be in [0, num_bins)
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Iter, typename BinIter>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>>
+histogram(const ExecPolicy &p,
+          Iter begin,
+          Iter end,
+          BinIter bins,
+          Index_type num_bins)
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<BinIter>::value,
+                "Bin Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return;
+  }
+  impl::histogram::histogram(p,
+                             begin,
+                             std::distance(begin, end),
+                             impl::histogram::detail::UnitWeight{},
+                             bins,
+                             num_bins);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  weighted histogram execution pattern
+*
+*         Adds weights[i] to bins[begin[i]] for every key in [begin, end).
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of key range
+* \param[in] end Pointer or Random-Access Iterator to end of key range
+*(exclusive)
+* \param[in] weights Pointer or Random-Access Iterator to the weight of each
+*key
+* \param[in,out] bins Pointer or Random-Access Iterator to the bins
+* \param[in] num_bins number of bins; every key must be in [0, num_bins)
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename WeightIter,
+          typename BinIter>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>>
+histogram(const ExecPolicy &p,
+          Iter begin,
+          Iter end,
+          WeightIter weights,
+          BinIter bins,
+          Index_type num_bins)
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<WeightIter>::value,
+                "Weight Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<BinIter>::value,
+                "Bin Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return;
+  }
+  impl::histogram::histogram(
+      p,
+      begin,
+      std::distance(begin, end),
+      impl::histogram::detail::IterWeight<WeightIter>{weights},
+      bins,
+      num_bins);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  reduce_by_key execution pattern
+*
+*         Reduces the values of every run of consecutive equal keys with
+*         binop, writing one key and its reduced value per run in order.
+*         Sort the keys first, e.g. with RAJA::sort_pairs, to reduce over
+*         all equal keys.
+*
+* \param[in] p Execution policy
+* \param[in] keys_begin Pointer or Random-Access Iterator to start of key range
+* \param[in] keys_end Pointer or Random-Access Iterator to end of key range
+*(exclusive)
+* \param[in] vals Pointer or Random-Access Iterator to start of value range
+* \param[out] keys_out Random-Access Iterator receiving the key of each run
+* \param[out] vals_out Random-Access Iterator receiving the value of each run
+* \param[in] binop binary function to reduce the values of a run with
+* \param[in] pred binary predicate comparing neighbouring keys
+*
+* \return the number of runs written
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename KeyOut,
+          typename ValOut,
+          typename Function = operators::plus<detail::IterVal<ValIter>>,
+          typename Predicate = operators::equal_to<detail::IterVal<KeyIter>>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value &&
+                            type_traits::is_iterator<KeyIter>::value,
+                        Index_type>::type
+reduce_by_key(const ExecPolicy &p,
+              KeyIter keys_begin,
+              KeyIter keys_end,
+              ValIter vals,
+              KeyOut keys_out,
+              ValOut vals_out,
+              Function binop = Function{},
+              Predicate pred = Predicate{})
+{
+  using R = detail::IterVal<ValIter>;
+  static_assert(type_traits::is_binary_function<Function, R, R, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "Key Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<ValIter>::value,
+                "Value Iterator must model RandomAccessIterator");
+  if (keys_begin == keys_end) {
+    return 0;
+  }
+  return impl::histogram::reduce_by_key(p,
+                                        keys_begin,
+                                        std::distance(keys_begin, keys_end),
+                                        vals,
+                                        keys_out,
+                                        vals_out,
+                                        binop,
+                                        pred);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>> histogram(
+    Args &&... args)
+{
+  histogram(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto reduce_by_key(Args &&... args)
+    -> decltype(reduce_by_key(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return reduce_by_key(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -180,6 +180,70 @@ class ReduceMaxLoc;
  */
 template <typename REDUCE_POLICY_T, typename T>
 class ReduceSum;
+
+//! Size of a ReduceSumArray whose number of sums is given at construction
+constexpr Index_type dynamic_reduce_size = 0;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Sum array reducer class template; N sums in one object.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   ReduceSumArray<reduce_policy, Real_type, 16> mat_sums(0.0);
+   ReduceSumArray<reduce_policy, Real_type> group_sums(num_groups, 0.0);
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      mat_sums[mat[i]] += data[i];
+      group_sums[group[i]] += data[i];
+   }
+
+   Real_type mat3_sum = mat_sums.get()[3];
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T,
+          typename T,
+          Index_type N = dynamic_reduce_size>
+class ReduceSumArray;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Reducer class template for a user-defined combine operator.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   struct Range { Real_type lo, hi; };
+   struct RangeOp {
+     static Range identity() { return {HUGE_VAL, -HUGE_VAL}; }
+     Range operator()(Range a, Range b) const
+     {
+       return {std::min(a.lo, b.lo), std::max(a.hi, b.hi)};
+     }
+   };
+
+   Reducer<reduce_policy, Range, RangeOp> my_range;
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      my_range.combine(Range{data[i], data[i]});
+   }
+
+   Range range = my_range.get();
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename T, typename Op>
+class Reducer;
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -26,6 +26,8 @@
 #include "camp/concepts.hpp"
 #include "camp/helpers.hpp"
 
+#include "RAJA/pattern/detail/scan.hpp"
+
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/util/Operators.hpp"
 
@@ -362,6 +364,439 @@ exclusive_scan(const ExecPolicy &p,
   impl::scan::exclusive(p, std::begin(c), std::end(c), out, binop, value);
 }
 
+// =============================================================================
+
+/*!
+******************************************************************************
+*
+* \brief  transform inclusive scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] unop unary function applied to each input element as it is read
+* \param[in] binop binary function to apply for scan
+*
+* \note{The range of [begin, end) must be separate from [out, out + dist (begin,
+*end)), or equal to it}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename IterOut,
+          typename UnaryFunction,
+          typename Function = operators::plus<detail::IterVal<IterOut>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<IterOut>>
+transform_inclusive_scan(const ExecPolicy &p,
+                         Iter begin,
+                         Iter end,
+                         IterOut out,
+                         UnaryFunction unop,
+                         Function binop = Function{})
+{
+  using R = detail::IterVal<IterOut>;
+  static_assert(type_traits::is_binary_function<Function, R, R, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return;
+  }
+  impl::scan::transform_inclusive(p, begin, end, out, binop, unop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  transform exclusive scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] unop unary function applied to each input element as it is read
+* \param[in] binop binary function to apply for scan
+* \param[in] value identity value for binary function, binop
+*
+* \note{The range of [begin, end) must be separate from [out, out + dist (begin,
+*end)), or equal to it}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename IterOut,
+          typename UnaryFunction,
+          typename T = detail::IterVal<IterOut>,
+          typename Function = operators::plus<T>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<IterOut>>
+transform_exclusive_scan(const ExecPolicy &p,
+                         Iter begin,
+                         Iter end,
+                         IterOut out,
+                         UnaryFunction unop,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  using R = detail::IterVal<IterOut>;
+  static_assert(type_traits::is_binary_function<Function, R, T, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return;
+  }
+  impl::scan::transform_exclusive(p, begin, end, out, binop, unop, value);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  transform inclusive scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] c Random-Access Container
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] unop unary function applied to each input element as it is read
+* \param[in] binop binary function to apply for scan
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename IterOut,
+          typename UnaryFunction,
+          typename Function = operators::plus<detail::IterVal<IterOut>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<Container>,
+                    type_traits::is_iterator<IterOut>>
+transform_inclusive_scan(const ExecPolicy &p,
+                         const Container &c,
+                         IterOut out,
+                         UnaryFunction unop,
+                         Function binop = Function{})
+{
+  using R = detail::IterVal<IterOut>;
+  static_assert(type_traits::is_binary_function<Function, R, R, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (std::begin(c) == std::end(c)) {
+    return;
+  }
+  impl::scan::transform_inclusive(
+      p, std::begin(c), std::end(c), out, binop, unop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  transform exclusive scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] c Random-Access Container
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] unop unary function applied to each input element as it is read
+* \param[in] binop binary function to apply for scan
+* \param[in] value identity value for binary function, binop
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename IterOut,
+          typename UnaryFunction,
+          typename T = detail::IterVal<IterOut>,
+          typename Function = operators::plus<T>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<Container>,
+                    type_traits::is_iterator<IterOut>>
+transform_exclusive_scan(const ExecPolicy &p,
+                         const Container &c,
+                         IterOut out,
+                         UnaryFunction unop,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  using R = detail::IterVal<IterOut>;
+  static_assert(type_traits::is_binary_function<Function, R, T, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (std::begin(c) == std::end(c)) {
+    return;
+  }
+  impl::scan::transform_exclusive(
+      p, std::begin(c), std::end(c), out, binop, unop, value);
+}
+
+// =============================================================================
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive scan by key execution pattern
+*
+*         Each run of consecutive equal keys is a segment, and the scan
+*         restarts at the first element of every segment.
+*
+* \param[in] p Execution policy
+* \param[in] keys_begin Pointer or Random-Access Iterator to start of keys
+* \param[in] keys_end Pointer or Random-Access Iterator to end of keys
+*(exclusive)
+* \param[in] values Pointer or Random-Access Iterator to start of values
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+* \param[in] pred binary predicate that is true for keys of the same segment
+*
+* \note{out may equal values, but must not overlap the keys}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename Iter,
+          typename IterOut,
+          typename Function = operators::plus<detail::IterVal<IterOut>>,
+          typename Predicate = operators::equal_to<detail::IterVal<KeyIter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<KeyIter>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<IterOut>>
+inclusive_scan_by_key(const ExecPolicy &p,
+                      KeyIter keys_begin,
+                      KeyIter keys_end,
+                      Iter values,
+                      IterOut out,
+                      Function binop = Function{},
+                      Predicate pred = Predicate{})
+{
+  using R = detail::IterVal<IterOut>;
+  using T = detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Function, R, R, T>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "Key Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (keys_begin == keys_end) {
+    return;
+  }
+  impl::scan::inclusive_segmented(
+      p,
+      values,
+      values + (keys_end - keys_begin),
+      out,
+      binop,
+      impl::scan::detail::KeyHead<KeyIter, Predicate>{keys_begin, pred});
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive scan by key execution pattern
+*
+*         Each run of consecutive equal keys is a segment, and every segment
+*         is scanned starting from value.
+*
+* \param[in] p Execution policy
+* \param[in] keys_begin Pointer or Random-Access Iterator to start of keys
+* \param[in] keys_end Pointer or Random-Access Iterator to end of keys
+*(exclusive)
+* \param[in] values Pointer or Random-Access Iterator to start of values
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+* \param[in] value identity value for binary function, binop
+* \param[in] pred binary predicate that is true for keys of the same segment
+*
+* \note{out may equal values, but must not overlap the keys}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename Iter,
+          typename IterOut,
+          typename T = detail::IterVal<IterOut>,
+          typename Function = operators::plus<T>,
+          typename Predicate = operators::equal_to<detail::IterVal<KeyIter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<KeyIter>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<IterOut>>
+exclusive_scan_by_key(const ExecPolicy &p,
+                      KeyIter keys_begin,
+                      KeyIter keys_end,
+                      Iter values,
+                      IterOut out,
+                      Function binop = Function{},
+                      T value = Function::identity(),
+                      Predicate pred = Predicate{})
+{
+  using R = detail::IterVal<IterOut>;
+  using U = detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Function, R, T, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "Key Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (keys_begin == keys_end) {
+    return;
+  }
+  impl::scan::exclusive_segmented(
+      p,
+      values,
+      values + (keys_end - keys_begin),
+      out,
+      binop,
+      impl::scan::detail::KeyHead<KeyIter, Predicate>{keys_begin, pred},
+      value);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive scan by head flag execution pattern
+*
+*         A non-zero flag marks the first element of a segment, and the scan
+*         restarts there.  The first element always starts a segment.
+*
+* \param[in] p Execution policy
+* \param[in] flags_begin Pointer or Random-Access Iterator to start of flags
+* \param[in] flags_end Pointer or Random-Access Iterator to end of flags
+*(exclusive)
+* \param[in] values Pointer or Random-Access Iterator to start of values
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+*
+* \note{out may equal values, but must not overlap the flags}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename FlagIter,
+          typename Iter,
+          typename IterOut,
+          typename Function = operators::plus<detail::IterVal<IterOut>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<FlagIter>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<IterOut>>
+inclusive_scan_by_flag(const ExecPolicy &p,
+                       FlagIter flags_begin,
+                       FlagIter flags_end,
+                       Iter values,
+                       IterOut out,
+                       Function binop = Function{})
+{
+  using R = detail::IterVal<IterOut>;
+  using T = detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Function, R, R, T>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<FlagIter>::value,
+                "Flag Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (flags_begin == flags_end) {
+    return;
+  }
+  impl::scan::inclusive_segmented(
+      p,
+      values,
+      values + (flags_end - flags_begin),
+      out,
+      binop,
+      impl::scan::detail::FlagHead<FlagIter>{flags_begin});
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive scan by head flag execution pattern
+*
+*         A non-zero flag marks the first element of a segment, and every
+*         segment is scanned starting from value.  The first element always
+*         starts a segment.
+*
+* \param[in] p Execution policy
+* \param[in] flags_begin Pointer or Random-Access Iterator to start of flags
+* \param[in] flags_end Pointer or Random-Access Iterator to end of flags
+*(exclusive)
+* \param[in] values Pointer or Random-Access Iterator to start of values
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+* \param[in] value identity value for binary function, binop
+*
+* \note{out may equal values, but must not overlap the flags}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename FlagIter,
+          typename Iter,
+          typename IterOut,
+          typename T = detail::IterVal<IterOut>,
+          typename Function = operators::plus<T>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<FlagIter>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<IterOut>>
+exclusive_scan_by_flag(const ExecPolicy &p,
+                       FlagIter flags_begin,
+                       FlagIter flags_end,
+                       Iter values,
+                       IterOut out,
+                       Function binop = Function{},
+                       T value = Function::identity())
+{
+  using R = detail::IterVal<IterOut>;
+  using U = detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Function, R, T, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<FlagIter>::value,
+                "Flag Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (flags_begin == flags_end) {
+    return;
+  }
+  impl::scan::exclusive_segmented(
+      p,
+      values,
+      values + (flags_end - flags_begin),
+      out,
+      binop,
+      impl::scan::detail::FlagHead<FlagIter>{flags_begin},
+      value);
+}
+
 template <typename ExecPolicy, typename... Args>
 concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
 exclusive_scan(Args &&... args)
@@ -390,6 +825,48 @@ inclusive_scan_inplace(Args &&... args)
   inclusive_scan_inplace(ExecPolicy{}, std::forward<Args>(args)...);
 }
 
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+transform_exclusive_scan(Args &&... args)
+{
+  transform_exclusive_scan(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+transform_inclusive_scan(Args &&... args)
+{
+  transform_inclusive_scan(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+exclusive_scan_by_key(Args &&... args)
+{
+  exclusive_scan_by_key(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+inclusive_scan_by_key(Args &&... args)
+{
+  inclusive_scan_by_key(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+exclusive_scan_by_flag(Args &&... args)
+{
+  exclusive_scan_by_flag(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+inclusive_scan_by_flag(Args &&... args)
+{
+  inclusive_scan_by_flag(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
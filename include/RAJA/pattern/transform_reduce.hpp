@@ -0,0 +1,203 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA transform-reduce declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_transform_reduce_HPP
+#define RAJA_transform_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "camp/concepts.hpp"
+#include "camp/helpers.hpp"
+
+#include "RAJA/pattern/detail/transform_reduce.hpp"
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+******************************************************************************
+*
+* \brief  transform_reduce execution pattern over a segment or container
+*
+*         Returns init combined with f(x) for every element x of c, e.g. with
+*         a RangeSegment: transform_reduce<exec_policy>(
+*             RangeSegment(0, N), 0.0, operators::plus<double>{},
+*             [=](Index_type i) { return a[i] * b[i]; });
+*
+*         No reducer object is created or copied.  OpenMP policies use a
+*         reduction clause when op is operators::plus, multiplies, minimum
+*         or maximum of an arithmetic type; TBB policies use
+*         tbb::parallel_reduce.
+*
+* \param[in] p Execution policy
+* \param[in] c Random-Access Container or Segment
+* \param[in] init initial value, which is also the result for an empty c
+* \param[in] op associative binary function combining values
+* \param[in] f unary function applied to each element
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename T,
+          typename BinaryOp,
+          typename UnaryOp>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value &&
+                            type_traits::is_range<Container>::value,
+                        T>::type
+transform_reduce(const ExecPolicy &p,
+                 const Container &c,
+                 T init,
+                 BinaryOp op,
+                 UnaryOp f)
+{
+  using Iter = camp::decay<decltype(std::begin(c))>;
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Container must model RandomAccessRange");
+  static_assert(type_traits::is_binary_function<BinaryOp, T, T, T>::value,
+                "BinaryOp must model BinaryFunction");
+  const Index_type n = std::distance(std::begin(c), std::end(c));
+  if (n <= 0) {
+    return init;
+  }
+  return impl::transform_reduce::reduce(
+      p,
+      n,
+      init,
+      op,
+      impl::transform_reduce::detail::UnaryTransform<T, Iter, UnaryOp>{
+          std::begin(c), f});
+}
+
+/*!
+******************************************************************************
+*
+* \brief  transform_reduce execution pattern over an iterator range
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] init initial value, which is also the result for an empty range
+* \param[in] op associative binary function combining values
+* \param[in] f unary function applied to each element
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename T,
+          typename BinaryOp,
+          typename UnaryOp>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value &&
+                            type_traits::is_iterator<Iter>::value &&
+                            !type_traits::is_iterator<T>::value,
+                        T>::type
+transform_reduce(const ExecPolicy &p,
+                 Iter begin,
+                 Iter end,
+                 T init,
+                 BinaryOp op,
+                 UnaryOp f)
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_binary_function<BinaryOp, T, T, T>::value,
+                "BinaryOp must model BinaryFunction");
+  if (begin == end) {
+    return init;
+  }
+  return impl::transform_reduce::reduce(
+      p,
+      std::distance(begin, end),
+      init,
+      op,
+      impl::transform_reduce::detail::UnaryTransform<T, Iter, UnaryOp>{begin,
+                                                                       f});
+}
+
+/*!
+******************************************************************************
+*
+* \brief  transform_reduce execution pattern over two iterator ranges
+*
+*         With the default operators this is the dot product of the ranges.
+*
+* \param[in] p Execution policy
+* \param[in] begin1 Pointer or Random-Access Iterator to start of first range
+* \param[in] end1 Pointer or Random-Access Iterator to end of first range
+*(exclusive)
+* \param[in] begin2 Pointer or Random-Access Iterator to start of second range
+* \param[in] init initial value, which is also the result for empty ranges
+* \param[in] op associative binary function combining values
+* \param[in] f binary function applied to each pair of elements
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter1,
+          typename Iter2,
+          typename T,
+          typename BinaryOp = operators::plus<T>,
+          typename BinaryTransform = operators::multiplies<T>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value &&
+                            type_traits::is_iterator<Iter1>::value &&
+                            type_traits::is_iterator<Iter2>::value,
+                        T>::type
+transform_reduce(const ExecPolicy &p,
+                 Iter1 begin1,
+                 Iter1 end1,
+                 Iter2 begin2,
+                 T init,
+                 BinaryOp op = BinaryOp{},
+                 BinaryTransform f = BinaryTransform{})
+{
+  static_assert(type_traits::is_random_access_iterator<Iter1>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<Iter2>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_binary_function<BinaryOp, T, T, T>::value,
+                "BinaryOp must model BinaryFunction");
+  if (begin1 == end1) {
+    return init;
+  }
+  return impl::transform_reduce::reduce(
+      p,
+      std::distance(begin1, end1),
+      init,
+      op,
+      impl::transform_reduce::detail::
+          BinaryTransform<T, Iter1, Iter2, BinaryTransform>{begin1, begin2, f});
+}
+
+template <typename ExecPolicy, typename... Args>
+auto transform_reduce(Args &&... args) -> decltype(
+    RAJA::transform_reduce(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return RAJA::transform_reduce(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,305 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA meta-policy that picks the fastest of a list of policies by
+ *          timing them on the first invocations of each loop.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_AutotunePolicy_HPP
+#define RAJA_AutotunePolicy_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iosfwd>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/plugins.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace autotune
+{
+
+//! Size buckets per call site; bucket b > 0 holds lengths [2^b, 2^(b+1))
+constexpr int num_size_buckets = 64;
+
+//! Size bucket of a loop of len iterations
+inline int sizeBucket(Index_type len)
+{
+  int bucket = 0;
+  while (len > 1 && bucket < num_size_buckets - 1) {
+    len >>= 1;
+    ++bucket;
+  }
+  return bucket;
+}
+
+/*!
+ * \brief Timings and decision for one call site and size bucket.
+ *
+ * choice is -1 while the candidates are being timed.  choice and
+ * num_candidates may be read without a lock; they and the other members are
+ * written under the lock of the owning AutotuneSite, num_candidates before
+ * choice.
+ */
+struct AutotuneEntry {
+  std::atomic<int> choice{-1};
+  std::atomic<int> num_candidates{0};
+  long long num_trials = 0;
+  std::vector<long long> calls;
+  std::vector<long long> iterations;
+  std::vector<double> seconds;
+
+  //! start timing num_candidates policies from scratch
+  void reset(int num_policies);
+};
+
+//! Autotuning state of one named loop
+struct AutotuneSite {
+  explicit AutotuneSite(std::string name) : name(std::move(name)) {}
+
+  std::string name;
+  std::mutex lock;
+  AutotuneEntry buckets[num_size_buckets];
+};
+
+//! Timing data of one call site and size bucket, see AutotuneRegistry
+struct AutotuneStatistics {
+  std::string name;
+  int bucket;
+  int choice;  //!< selected policy, or -1 while tuning
+  std::vector<long long> calls;
+  std::vector<long long> iterations;
+  std::vector<double> seconds;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Process-wide record of the call sites of AutotunePolicy.
+ *
+ *         Decisions can be written to a file with save() and read back with
+ *         load(), so that later runs start with the choices already made.
+ *         Loading before the first invocation of a loop takes effect for
+ *         that loop; a choice loaded for a candidate list of another
+ *         length is ignored and the loop is tuned again.
+ *
+ ******************************************************************************
+ */
+class AutotuneRegistry
+{
+public:
+  static AutotuneRegistry& getInstance();
+
+  AutotuneRegistry(const AutotuneRegistry&) = delete;
+  AutotuneRegistry& operator=(const AutotuneRegistry&) = delete;
+
+  //! Return the site called name, creating it on first use.
+  AutotuneSite& getSite(const std::string& name);
+
+  //! Write the decided entries to filename; throws std::runtime_error.
+  void save(const std::string& filename) const;
+
+  //! Read decisions written by save(); throws std::runtime_error.
+  void load(const std::string& filename);
+
+  //! Discard all timings and decisions.
+  void reset();
+
+  //! Timings and decisions of every bucket that has been used or loaded.
+  std::vector<AutotuneStatistics> statistics() const;
+
+  //! Print statistics() as a table.
+  void print(std::ostream& os) const;
+
+private:
+  AutotuneRegistry() = default;
+
+  mutable std::mutex m_lock;
+  std::map<std::string, std::unique_ptr<AutotuneSite>> m_sites;
+};
+
+namespace detail
+{
+
+template <typename... Policies>
+struct autotune_invoker;
+
+template <typename Policy, typename... Rest>
+struct autotune_invoker<Policy, Rest...> {
+  template <typename Iterable, typename Body>
+  static void invoke(int index, Iterable&& iter, Body&& body)
+  {
+    if (index == 0) {
+      util::PluginContext context{util::make_context<Policy>()};
+      util::callPreLaunchPlugins(context);
+
+      wrap::forall(Policy{}, iter, body);
+
+      util::callPostLaunchPlugins(context);
+    } else {
+      autotune_invoker<Rest...>::invoke(index - 1, iter, body);
+    }
+  }
+};
+
+template <>
+struct autotune_invoker<> {
+  template <typename Iterable, typename Body>
+  static void invoke(int, Iterable&&, Body&&)
+  {
+    throw std::runtime_error("unknown offset invoked");
+  }
+};
+
+}  // namespace detail
+
+/// AutotunePolicy - Meta-policy choosing between a compile-time list of
+/// policies by measuring them
+///
+/// The first Trials invocations per candidate of each size bucket of a call
+/// site run the candidates in turn and time them; afterwards the candidate
+/// with the least time per iteration is used for that bucket.
+///
+/// \tparam Policies Variadic pack of policies, numbered from 0
+template <typename... Policies>
+class AutotunePolicy
+{
+  static_assert(sizeof...(Policies) > 0,
+                "AutotunePolicy needs at least one policy");
+
+public:
+  static constexpr int num_policies = sizeof...(Policies);
+
+  AutotunePolicy() = delete;  // No default construction
+  AutotunePolicy(const std::string& name, int trials = 3)
+      : m_site(&AutotuneRegistry::getInstance().getSite(name)),
+        m_trials(trials > 0 ? trials : 1)
+  {
+  }
+
+  const std::string& name() const { return m_site->name; }
+
+  template <typename Iterable, typename Body>
+  void invoke(Iterable&& iter, Body&& body) const
+  {
+    using std::begin;
+    using std::end;
+    const Index_type len = std::distance(begin(iter), end(iter));
+    AutotuneEntry& entry = m_site->buckets[sizeBucket(len)];
+
+    // a choice made for another candidate list must not be used
+    const int choice = entry.choice.load(std::memory_order_acquire);
+    if (choice >= 0 && choice < num_policies
+        && entry.num_candidates.load(std::memory_order_relaxed)
+               == num_policies) {
+      detail::autotune_invoker<Policies...>::invoke(choice, iter, body);
+      return;
+    }
+
+    int candidate;
+    {
+      std::lock_guard<std::mutex> guard(m_site->lock);
+      if (entry.num_candidates != num_policies
+          || entry.choice.load(std::memory_order_relaxed) >= num_policies) {
+        entry.reset(num_policies);
+      }
+      candidate = static_cast<int>(entry.num_trials++ % num_policies);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    detail::autotune_invoker<Policies...>::invoke(candidate, iter, body);
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    std::lock_guard<std::mutex> guard(m_site->lock);
+    if (entry.num_candidates != num_policies) return;
+    entry.calls[candidate] += 1;
+    entry.iterations[candidate] += len;
+    entry.seconds[candidate] += elapsed.count();
+
+    if (entry.choice.load(std::memory_order_relaxed) >= 0) return;
+    int best = 0;
+    for (int p = 0; p < num_policies; ++p) {
+      if (entry.calls[p] < m_trials) return;
+      // compare time per iteration; the +1 keeps empty loops comparable
+      if (entry.seconds[p] * (entry.iterations[best] + 1)
+          < entry.seconds[best] * (entry.iterations[p] + 1)) {
+        best = p;
+      }
+    }
+    entry.choice.store(best, std::memory_order_release);
+  }
+
+private:
+  AutotuneSite* m_site;
+  int m_trials;
+};
+
+template <typename... Policies>
+constexpr int AutotunePolicy<Policies...>::num_policies;
+
+/// forall_impl - AutotunePolicy specialization, select at runtime from a
+/// compile-time list of policies, build with make_autotune_policy()
+/// \param p AutotunePolicy to use for selection
+/// \param iter iterable of items to supply to body
+/// \param body functor, will receive each value produced by iterable iter
+template <typename Iterable, typename Body, typename... Policies>
+RAJA_INLINE void forall_impl(const AutotunePolicy<Policies...>& p,
+                             Iterable&& iter,
+                             Body&& body)
+{
+  p.invoke(iter, body);
+}
+
+}  // end namespace autotune
+}  // end namespace policy
+
+using policy::autotune::AutotunePolicy;
+using policy::autotune::AutotuneRegistry;
+using policy::autotune::AutotuneStatistics;
+
+/// make_autotune_policy - Construct an AutotunePolicy for the loop called
+/// name
+///
+/// \tparam Policies list of candidate policies, 0 to N-1
+/// \param name identifies the call site in the registry and in saved files;
+/// loops sharing a name share their decisions
+/// \param trials number of timed invocations of each candidate per size
+/// bucket before a choice is made
+template <typename... Policies>
+AutotunePolicy<Policies...> make_autotune_policy(const std::string& name,
+                                                 int trials = 3)
+{
+  return AutotunePolicy<Policies...>(name, trials);
+}
+
+}  // end namespace RAJA
+
+#endif
@@ -35,7 +35,8 @@ enum class Policy {
   target_openmp,
   cuda,
   hip,
-  tbb
+  tbb,
+  threads
 };
 
 enum class Pattern {
@@ -113,6 +114,9 @@ namespace reduce
 struct ordered {
 };
 
+struct reproducible {
+};
+
 }  // namespace reduce
 
 
@@ -168,6 +172,9 @@ template <typename Pol>
 struct is_tbb_policy : RAJA::policy_is<Pol, RAJA::Policy::tbb> {
 };
 template <typename Pol>
+struct is_threads_policy : RAJA::policy_is<Pol, RAJA::Policy::threads> {
+};
+template <typename Pol>
 struct is_target_openmp_policy
     : RAJA::policy_is<Pol, RAJA::Policy::target_openmp> {
 };
@@ -0,0 +1,154 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining prefetch_exec, a forall policy wrapper
+ *          that prefetches the gathers of indirect loops ahead of use.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PrefetchPolicy_HPP
+#define RAJA_PrefetchPolicy_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+#include "RAJA/index/PrefetchListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/policy/AutotunePolicy.hpp"
+#include "RAJA/policy/PolicyBase.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace prefetch
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Forall policy that runs ExecPolicy over a PrefetchListSegment and
+ *         prefetches the gather targets Distance iterations ahead.
+ *
+ *         The loop runs over the positions of the list with ExecPolicy, so
+ *         any host policy may be used; each thread prefetches for the
+ *         position Distance after the one it is executing.  A good Distance
+ *         covers the memory latency with the work of the iterations in
+ *         between; make_prefetch_autotune_policy picks one by measurement.
+ *         Other iterables are executed by ExecPolicy without prefetching.
+ *
+ ******************************************************************************
+ */
+template <typename ExecPolicy, size_t Distance = 16>
+struct prefetch_exec
+    : make_policy_pattern_launch_platform_t<Policy::undefined,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+  static_assert(Distance > 0, "prefetch_exec needs a positive distance");
+
+  using inner_policy = ExecPolicy;
+};
+
+namespace detail
+{
+
+//! Loop body over list positions that prefetches ahead, then runs body
+template <typename Segment, typename Body>
+struct PrefetchBody {
+  Segment seg;
+  Body body;
+  Index_type distance;
+
+  RAJA_INLINE void operator()(Index_type pos) const
+  {
+    if (pos + distance < seg.size()) {
+      seg.prefetch(pos + distance);
+    }
+    body(seg.begin()[pos]);
+  }
+};
+
+template <typename ExecPolicy,
+          size_t Distance,
+          typename Func,
+          typename T,
+          typename... Targets>
+RAJA_INLINE void forall_prefetch(const PrefetchListSegment<T, Targets...>& seg,
+                                 Func&& loop_body)
+{
+  PrefetchBody<PrefetchListSegment<T, Targets...>,
+               typename std::decay<Func>::type>
+      body{seg, loop_body, static_cast<Index_type>(Distance)};
+
+  forall_impl(ExecPolicy{},
+              TypedRangeSegment<Index_type>(0, seg.size()),
+              body);
+}
+
+template <typename ExecPolicy,
+          size_t Distance,
+          typename Iterable,
+          typename Func>
+RAJA_INLINE void forall_prefetch(Iterable&& iter, Func&& loop_body)
+{
+  forall_impl(ExecPolicy{}, iter, loop_body);
+}
+
+}  // namespace detail
+
+template <typename Iterable, typename Func, typename ExecPolicy, size_t Distance>
+RAJA_INLINE void forall_impl(const prefetch_exec<ExecPolicy, Distance>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  detail::forall_prefetch<ExecPolicy, Distance>(
+      static_cast<const typename std::decay<Iterable>::type&>(iter),
+      loop_body);
+}
+
+}  // end namespace prefetch
+}  // end namespace policy
+
+using policy::prefetch::prefetch_exec;
+
+/*!
+ * \brief AutotunePolicy choosing between ExecPolicy alone and prefetch_exec
+ *        with distances of 4, 16 and 64 iterations, for the loop called name.
+ *
+ * Pass it a PrefetchListSegment; decisions are kept per loop and size
+ * bucket and can be saved with AutotuneRegistry.
+ */
+template <typename ExecPolicy>
+AutotunePolicy<ExecPolicy,
+               prefetch_exec<ExecPolicy, 4>,
+               prefetch_exec<ExecPolicy, 16>,
+               prefetch_exec<ExecPolicy, 64>>
+make_prefetch_autotune_policy(const std::string& name, int trials = 3)
+{
+  return make_autotune_policy<ExecPolicy,
+                              prefetch_exec<ExecPolicy, 4>,
+                              prefetch_exec<ExecPolicy, 16>,
+                              prefetch_exec<ExecPolicy, 64>>(name, trials);
+}
+
+}  // end namespace RAJA
+
+#endif
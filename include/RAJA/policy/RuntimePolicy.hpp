@@ -0,0 +1,193 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining runtime_exec, a forall policy whose
+ *          host back-end is chosen at run time.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_RuntimePolicy_HPP
+#define RAJA_RuntimePolicy_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+#include <string>
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/policy/loop.hpp"
+#include "RAJA/policy/sequential.hpp"
+#include "RAJA/policy/simd.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include "RAJA/policy/openmp.hpp"
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+#include "RAJA/policy/tbb.hpp"
+#endif
+
+#if defined(RAJA_ENABLE_THREADS)
+#include "RAJA/policy/threads.hpp"
+#endif
+
+namespace RAJA
+{
+
+//! Host policies runtime_exec can dispatch to
+enum class RuntimePolicy : int {
+  seq_exec,
+  loop_exec,
+  simd_exec,
+  omp_parallel_for_exec,
+  tbb_for_dynamic,
+  threads_for_dynamic
+};
+
+//! Whether policy p was enabled when RAJA was configured.
+bool runtime_policy_available(RuntimePolicy p);
+
+//! Name of p, which is also the name of the matching RAJA policy type.
+std::string to_string(RuntimePolicy p);
+
+//! Inverse of to_string; throws std::runtime_error for unknown names.
+RuntimePolicy runtime_policy_from_string(const std::string& name);
+
+//! Policy used by loops that have not been given one of their own.
+void set_runtime_policy(RuntimePolicy p);
+
+//! Policy used by runtime_exec(loop_name) loops.
+void set_runtime_policy(const std::string& loop_name, RuntimePolicy p);
+
+//! Current policy of runtime_exec(loop_name); "" is the default policy.
+RuntimePolicy get_runtime_policy(const std::string& loop_name = "");
+
+/*!
+ * \brief Read "loop_name policy_name" lines from filename.
+ *
+ * Blank lines and lines starting with '#' are skipped, and the loop name
+ * "default" sets the default policy.  Throws std::runtime_error if the file
+ * cannot be read or names a policy that is unknown or not available.
+ */
+void load_runtime_policy_config(const std::string& filename);
+
+namespace policy
+{
+namespace runtime
+{
+
+//! Slot holding a RuntimePolicy value, or -1 to follow the default policy
+using runtime_slot = std::atomic<int>;
+
+//! The slot of loop_name, created on first use; "" is the default slot.
+const runtime_slot* getRuntimeSlot(const std::string& loop_name);
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Forall policy that executes with the host policy selected at run
+ *         time.
+ *
+ *         The policy comes from, in increasing order of precedence: seq_exec;
+ *         the config file named by the RAJA_RUNTIME_POLICY_FILE environment
+ *         variable; the RAJA_RUNTIME_POLICY environment variable (default
+ *         policy only); load_runtime_policy_config(); set_runtime_policy().
+ *
+ *         A named runtime_exec looks up its loop when constructed, so keep
+ *         it in a static or long-lived variable in hot code; each execution
+ *         then costs two atomic loads and a switch.  Reductions inside the
+ *         loop need a reduce policy that is valid for every policy the loop
+ *         may be run with: an atomic-based reduction, or omp_reduce, whose
+ *         copies take a lock when they are folded outside an OpenMP team.
+ *
+ * Usage example:
+ *
+ * \verbatim
+ *
+ *   static const RAJA::runtime_exec daxpy_pol("daxpy");
+ *   RAJA::forall(daxpy_pol, RAJA::RangeSegment(0, N), [=](int i) {
+ *     y[i] += a * x[i];
+ *   });
+ *
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+struct runtime_exec
+    : make_policy_pattern_launch_platform_t<Policy::undefined,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+  runtime_exec() : runtime_exec(std::string()) {}
+
+  explicit runtime_exec(const std::string& loop_name)
+      : m_slot(getRuntimeSlot(loop_name)), m_default(getRuntimeSlot(""))
+  {
+  }
+
+  RuntimePolicy get() const
+  {
+    int p = m_slot->load(std::memory_order_relaxed);
+    if (p < 0) p = m_default->load(std::memory_order_relaxed);
+    return static_cast<RuntimePolicy>(p);
+  }
+
+private:
+  const runtime_slot* m_slot;
+  const runtime_slot* m_default;
+};
+
+template <typename Iterable, typename Func>
+RAJA_INLINE void forall_impl(const runtime_exec& p,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  switch (p.get()) {
+    case RuntimePolicy::loop_exec:
+      forall_impl(RAJA::loop_exec{}, iter, loop_body);
+      break;
+    case RuntimePolicy::simd_exec:
+      forall_impl(RAJA::simd_exec{}, iter, loop_body);
+      break;
+#if defined(RAJA_ENABLE_OPENMP)
+    case RuntimePolicy::omp_parallel_for_exec:
+      forall_impl(RAJA::omp_parallel_for_exec{}, iter, loop_body);
+      break;
+#endif
+#if defined(RAJA_ENABLE_TBB)
+    case RuntimePolicy::tbb_for_dynamic:
+      forall_impl(RAJA::tbb_for_dynamic{}, iter, loop_body);
+      break;
+#endif
+#if defined(RAJA_ENABLE_THREADS)
+    case RuntimePolicy::threads_for_dynamic:
+      forall_impl(RAJA::threads_for_dynamic<>{}, iter, loop_body);
+      break;
+#endif
+    default:
+      forall_impl(RAJA::seq_exec{}, iter, loop_body);
+      break;
+  }
+}
+
+}  // end namespace runtime
+}  // end namespace policy
+
+using policy::runtime::runtime_exec;
+
+}  // end namespace RAJA
+
+#endif
@@ -0,0 +1,109 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining streaming_exec, a forall policy wrapper
+ *          for loops that write through streaming (non-temporal) stores.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_StreamingPolicy_HPP
+#define RAJA_StreamingPolicy_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+#include <utility>
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/streaming.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace streaming
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Host forall policy that runs ExecPolicy and fences the streaming
+ *         stores of every thread before the loop returns.
+ *
+ *         Streaming stores (see streaming_ptr) are weakly ordered, so a
+ *         thread must fence before another thread may read what it wrote.
+ *         The loop body is wrapped in an object that fences when it is
+ *         destroyed; parallel host policies destroy their per-thread copy
+ *         of the body before the threads join, and the calling thread
+ *         fences once more when the loop ends.
+ *
+ ******************************************************************************
+ */
+template <typename ExecPolicy>
+struct streaming_exec
+    : make_policy_pattern_launch_platform_t<Policy::undefined,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+  using inner_policy = ExecPolicy;
+};
+
+namespace detail
+{
+
+//! Loop body that issues streaming_fence() when destroyed
+template <typename Body>
+struct StreamingBody {
+  Body body;
+
+  explicit StreamingBody(const Body& b) : body(b) {}
+
+  StreamingBody(const StreamingBody&) = default;
+
+  ~StreamingBody() { streaming_fence(); }
+
+  template <typename... Args>
+  RAJA_INLINE void operator()(Args&&... args) const
+  {
+    body(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  RAJA_INLINE void operator()(Args&&... args)
+  {
+    body(std::forward<Args>(args)...);
+  }
+};
+
+}  // namespace detail
+
+template <typename Iterable, typename Func, typename ExecPolicy>
+RAJA_INLINE void forall_impl(const streaming_exec<ExecPolicy>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  // body fences on this thread when it goes out of scope
+  detail::StreamingBody<typename std::decay<Func>::type> body(loop_body);
+  forall_impl(ExecPolicy{}, iter, body);
+}
+
+}  // end namespace streaming
+}  // end namespace policy
+
+using policy::streaming::streaming_exec;
+
+}  // end namespace RAJA
+
+#endif
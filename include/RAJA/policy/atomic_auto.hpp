@@ -24,6 +24,10 @@
 
 #include "RAJA/policy/sequential/atomic.hpp"
 
+#if defined(RAJA_ENABLE_THREADS)
+#include "RAJA/policy/atomic_builtin.hpp"
+#endif
+
 /*!
  * Provides priority between atomic policies that should do the "right thing"
  *
@@ -33,6 +37,10 @@
  * Next, if OpenMP is enabled we always use the omp_atomic, which should
  * generally work everywhere.
  *
+ * Otherwise, if RAJA was configured with ENABLE_THREADS (off by default) we
+ * use builtin_atomic, since loops may run concurrently on the pool threads.
+ * Builds without OpenMP or the thread pool keep seq_atomic.
+ *
  * Finally, we fallback on the seq_atomic, which performs non-atomic operations
  * because we assume there is no thread safety issues (no parallel model)
  */
@@ -45,6 +53,9 @@
 #elif defined(RAJA_ENABLE_OPENMP)
 #define RAJA_AUTO_ATOMIC \
   RAJA::omp_atomic {}
+#elif defined(RAJA_ENABLE_THREADS)
+#define RAJA_AUTO_ATOMIC \
+  RAJA::builtin_atomic {}
 #else
 #define RAJA_AUTO_ATOMIC \
   RAJA::seq_atomic {}
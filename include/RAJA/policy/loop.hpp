@@ -25,5 +25,8 @@
 #include "RAJA/policy/loop/kernel.hpp"
 #include "RAJA/policy/loop/policy.hpp"
 #include "RAJA/policy/loop/scan.hpp"
+#include "RAJA/policy/loop/sort.hpp"
+#include "RAJA/policy/loop/histogram.hpp"
+#include "RAJA/policy/loop/transform_reduce.hpp"
 
 #endif  // closing endif for header file include guard
@@ -32,6 +32,8 @@
 
 #include "RAJA/internal/fault_tolerance.hpp"
 
+#include "RAJA/pattern/detail/forall_param.hpp"
+
 using RAJA::concepts::enable_if;
 
 namespace RAJA
@@ -61,6 +63,28 @@ RAJA_INLINE void forall_impl(const loop_exec &, Iterable &&iter, Func &&body)
   }
 }
 
+//! The whole range is one chunk
+template <typename Segment, typename Func>
+RAJA_INLINE void forall_chunked_impl(const loop_exec &,
+                                     Segment &&seg,
+                                     Func &&body)
+{
+  body(seg);
+}
+
+//! One set of accumulators for the whole loop
+template <typename Iterable, typename Func, typename... Params>
+RAJA_INLINE void forall_param_impl(
+    const loop_exec &p,
+    Iterable &&iter,
+    RAJA::detail::ForallParamPack<Params...> const &params,
+    Func &&body)
+{
+  auto values = params.identities();
+  forall_impl(p, iter, RAJA::detail::makeForallParamBody(body, values));
+  params.finalize(values);
+}
+
 }  // namespace loop
 
 }  // namespace policy
@@ -29,6 +29,7 @@
 #include <iostream>
 #include <thread>
 
+#include "RAJA/policy/openmp/affinity.hpp"
 #include "RAJA/policy/openmp/atomic.hpp"
 #include "RAJA/policy/openmp/forall.hpp"
 #include "RAJA/policy/openmp/kernel.hpp"
@@ -36,6 +37,9 @@
 #include "RAJA/policy/openmp/reduce.hpp"
 #include "RAJA/policy/openmp/region.hpp"
 #include "RAJA/policy/openmp/scan.hpp"
+#include "RAJA/policy/openmp/sort.hpp"
+#include "RAJA/policy/openmp/histogram.hpp"
+#include "RAJA/policy/openmp/transform_reduce.hpp"
 #include "RAJA/policy/openmp/synchronize.hpp"
 
 #endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
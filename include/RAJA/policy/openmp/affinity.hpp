@@ -0,0 +1,135 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing host memory allocation that places pages
+ *          by first touch with the partition of omp_affinity_static_exec.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_openmp_affinity_HPP
+#define RAJA_openmp_affinity_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <cstddef>
+#include <cstring>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/policy/openmp/forall.hpp"
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+
+//! Alignment of affinity allocations; a page on common systems
+constexpr size_t affinity_alignment = 4096;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Allocate zero-filled storage for n objects of type T whose pages
+ *         are first touched by the threads that ExecPolicy will use for the
+ *         same indices.
+ *
+ *         Operating systems place a page in the memory of the NUMA domain
+ *         of the thread that first writes it.  Element i is zeroed by the
+ *         thread that runs index i of a loop with ExecPolicy, so later loops
+ *         with that policy read and write memory local to their socket.
+ *         Placement follows pages, so BlockSize * sizeof(T) should be a
+ *         multiple of the page size; the default BlockSize of 2048 gives
+ *         this for types of 2 bytes or more.
+ *
+ *         Threads should be bound to cores (OMP_PROC_BIND, or the Pin
+ *         parameter of omp_affinity_static_exec) and the number of threads
+ *         kept fixed, or the operating system may move threads away from
+ *         their pages.
+ *
+ *         Storage must be released with omp_affinity_free.  No constructors
+ *         are run; T should be trivially constructible.
+ *
+ ******************************************************************************
+ */
+template <typename T,
+          typename ExecPolicy = omp_affinity_static_exec<>>
+T* omp_affinity_allocate(size_t n)
+{
+  T* ptr = allocate_aligned_type<T>(affinity_alignment,
+                                    (n > 0 ? n : 1) * sizeof(T));
+  if (ptr == nullptr) {
+    RAJA_ABORT_OR_THROW("omp_affinity_allocate: allocation failed");
+  }
+
+  char* bytes = reinterpret_cast<char*>(ptr);
+  ::RAJA::policy::omp::forall_impl(
+      ExecPolicy{},
+      TypedRangeSegment<Index_type>(0, static_cast<Index_type>(n)),
+      [=](Index_type i) { std::memset(bytes + i * sizeof(T), 0, sizeof(T)); });
+
+  return ptr;
+}
+
+//! Release storage from omp_affinity_allocate
+inline void omp_affinity_free(void* ptr) { free_aligned(ptr); }
+
+/*!
+ * \brief Standard allocator using omp_affinity_allocate, for containers
+ *        such as std::vector whose elements are processed with ExecPolicy.
+ */
+template <typename T, typename ExecPolicy = omp_affinity_static_exec<>>
+struct omp_affinity_allocator {
+  using value_type = T;
+
+  template <typename U>
+  struct rebind {
+    using other = omp_affinity_allocator<U, ExecPolicy>;
+  };
+
+  omp_affinity_allocator() = default;
+
+  template <typename U>
+  omp_affinity_allocator(const omp_affinity_allocator<U, ExecPolicy>&)
+  {
+  }
+
+  T* allocate(size_t n) { return omp_affinity_allocate<T, ExecPolicy>(n); }
+
+  void deallocate(T* ptr, size_t) { omp_affinity_free(ptr); }
+};
+
+template <typename T, typename U, typename ExecPolicy>
+bool operator==(const omp_affinity_allocator<T, ExecPolicy>&,
+                const omp_affinity_allocator<U, ExecPolicy>&)
+{
+  return true;
+}
+
+template <typename T, typename U, typename ExecPolicy>
+bool operator!=(const omp_affinity_allocator<T, ExecPolicy>&,
+                const omp_affinity_allocator<U, ExecPolicy>&)
+{
+  return false;
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
+
+#endif  // closing endif for header file include guard
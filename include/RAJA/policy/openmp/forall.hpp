@@ -25,8 +25,10 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
+#include <algorithm>
 #include <iostream>
 #include <type_traits>
+#include <vector>
 
 #include <omp.h>
 
@@ -40,6 +42,8 @@
 
 #include "RAJA/policy/openmp/policy.hpp"
 
+#include "RAJA/pattern/detail/forall_param.hpp"
+#include "RAJA/pattern/detail/transform_reduce.hpp"
 #include "RAJA/pattern/forall.hpp"
 #include "RAJA/pattern/region.hpp"
 
@@ -116,6 +120,555 @@ RAJA_INLINE void forall_impl(const omp_for_static<ChunkSize>&,
   }
 }
 
+///
+/// OpenMP for dynamic policy implementation
+///
+
+template <typename Iterable, typename Func>
+RAJA_INLINE void forall_impl(const omp_for_dynamic<0>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+#pragma omp for schedule(dynamic)
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    loop_body(begin_it[i]);
+  }
+}
+
+template <typename Iterable, typename Func, unsigned int ChunkSize>
+RAJA_INLINE void forall_impl(const omp_for_dynamic<ChunkSize>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+#pragma omp for schedule(dynamic, ChunkSize)
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    loop_body(begin_it[i]);
+  }
+}
+
+///
+/// OpenMP for guided policy implementation
+///
+
+template <typename Iterable, typename Func>
+RAJA_INLINE void forall_impl(const omp_for_guided<0>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+#pragma omp for schedule(guided)
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    loop_body(begin_it[i]);
+  }
+}
+
+template <typename Iterable, typename Func, unsigned int ChunkSize>
+RAJA_INLINE void forall_impl(const omp_for_guided<ChunkSize>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+#pragma omp for schedule(guided, ChunkSize)
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    loop_body(begin_it[i]);
+  }
+}
+
+///
+/// OpenMP for runtime schedule policy implementation
+///
+
+template <typename Iterable, typename Func>
+RAJA_INLINE void forall_impl(const omp_for_runtime&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+#pragma omp for schedule(runtime)
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    loop_body(begin_it[i]);
+  }
+}
+
+///
+/// OpenMP taskloop policy implementation
+///
+
+namespace detail
+{
+
+/*!
+ * \brief Iterations per task for a taskloop over len iterations.
+ *
+ * A GrainSize of 0 aims for several tasks per team thread, so the runtime
+ * can balance nested loops across threads that finish early.
+ */
+template <unsigned int GrainSize, typename LenT>
+RAJA_INLINE LenT taskloopGrainSize(LenT len)
+{
+  constexpr LenT tasks_per_thread = 8;
+  return GrainSize > 0
+             ? static_cast<LenT>(GrainSize)
+             : std::max(LenT(1),
+                        len / (tasks_per_thread * omp_get_num_threads()));
+}
+
+//! Number of taskloop task bodies running on the calling thread
+RAJA_INLINE int& omp_taskloop_depth()
+{
+  static thread_local int depth = 0;
+  return depth;
+}
+
+//! Marks the calling thread as running a taskloop task while it lives
+struct OmpTaskloopTaskScope {
+  OmpTaskloopTaskScope() { ++omp_taskloop_depth(); }
+  ~OmpTaskloopTaskScope() { --omp_taskloop_depth(); }
+};
+
+/*!
+ * \brief Run task_gen on one thread of a team whose other threads execute
+ *        the tasks it generates.
+ *
+ * Inside a taskloop task, the task generates the nested tasks itself.
+ * Inside an active parallel region every thread of the team reaches the
+ * loop, as for omp_for_exec; one of them generates the tasks and the
+ * barrier ending the single lets the others run them, so no threads are
+ * added.  Otherwise a parallel region is created for the purpose.
+ */
+template <typename Func>
+RAJA_INLINE void omp_taskloop_region(Func&& task_gen)
+{
+  if (omp_taskloop_depth() > 0) {
+    task_gen();
+  } else if (omp_in_parallel()) {
+#pragma omp single
+    task_gen();
+  } else {
+#pragma omp parallel
+#pragma omp single
+    task_gen();
+  }
+}
+
+}  // namespace detail
+
+template <typename Iterable, typename Func, unsigned int GrainSize>
+RAJA_INLINE void forall_impl(const omp_taskloop_exec<GrainSize>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+  detail::omp_taskloop_region([&]() {
+    const auto grain = detail::taskloopGrainSize<GrainSize>(distance_it);
+    // each task gets its own copy of the body, so reducer copies are merged
+    // into their parent as tasks complete
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(loop_body);
+#pragma omp taskloop firstprivate(privatizer) grainsize(grain)
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      detail::OmpTaskloopTaskScope task_scope;
+      privatizer.get_priv()(begin_it[i]);
+    }
+  });
+}
+
+///
+/// OpenMP affinity static policy implementation
+///
+
+namespace detail
+{
+
+//! Key of the first iteration: the index value for ranges, else position 0
+template <typename Iterable>
+RAJA_INLINE long long affinityKeyBase(Iterable const&)
+{
+  return 0;
+}
+
+template <typename StorageT, typename DiffT>
+RAJA_INLINE long long affinityKeyBase(
+    TypedRangeSegment<StorageT, DiffT> const& seg)
+{
+  return static_cast<long long>(stripIndexType(*seg.begin()));
+}
+
+template <typename Func>
+RAJA_INLINE void omp_affinity_region(std::false_type, Func&& f)
+{
+#pragma omp parallel
+  f();
+}
+
+template <typename Func>
+RAJA_INLINE void omp_affinity_region(std::true_type, Func&& f)
+{
+#pragma omp parallel proc_bind(close)
+  f();
+}
+
+//! floor(a / b) for b > 0
+RAJA_INLINE long long floorDiv(long long a, long long b)
+{
+  return a / b - (a % b < 0 ? 1 : 0);
+}
+
+}  // namespace detail
+
+/*!
+ * Iterations are keyed by index value for range segments and by position
+ * for other iterables.  Keys are grouped into blocks of BlockSize, and
+ * block b runs on thread b % T of a team of T threads, so the thread that
+ * executes a given index does not depend on the loop bounds.  The mapping
+ * is stable as long as the team size does not change between loops.
+ */
+template <typename Iterable, typename Func, size_t BlockSize, bool Pin>
+RAJA_INLINE void forall_impl(const omp_affinity_static_exec<BlockSize, Pin>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+  if (distance_it <= 0) return;
+
+  const long long key_first = detail::affinityKeyBase(iter);
+  const long long key_last = key_first + static_cast<long long>(distance_it);
+  const long long block = static_cast<long long>(BlockSize);
+  const long long first_block = detail::floorDiv(key_first, block);
+  const long long last_block = detail::floorDiv(key_last - 1, block) + 1;
+
+  detail::omp_affinity_region(
+      std::integral_constant<bool, Pin>{}, [&]() {
+        using RAJA::internal::thread_privatize;
+        auto privatizer = thread_privatize(loop_body);
+        auto& body = privatizer.get_priv();
+
+        const long long num_threads = omp_get_num_threads();
+        const long long thread = omp_get_thread_num();
+
+        // first block at or after first_block owned by this thread
+        long long b = first_block
+                      + ((thread - first_block) % num_threads + num_threads)
+                            % num_threads;
+        for (; b < last_block; b += num_threads) {
+          const long long lo = std::max(key_first, b * block);
+          const long long hi = std::min(key_last, (b + 1) * block);
+          for (long long k = lo; k < hi; ++k) {
+            body(begin_it[static_cast<decltype(distance_it)>(k - key_first)]);
+          }
+        }
+      });
+}
+
+///
+/// Chunked implementations; see RAJA::forall_chunked
+///
+
+namespace detail
+{
+
+/*!
+ * \brief Pass chunks of chunk_size iterations of seg to body, one chunk
+ *        per iteration of an omp for loop.
+ *
+ * Chunks are dealt round-robin, or on demand if Dynamic.  Must be called
+ * by every thread of the team; NoWait drops the barrier at the end.
+ */
+template <bool Dynamic, bool NoWait, typename Segment, typename Func>
+RAJA_INLINE void omp_for_chunks(Segment const& seg,
+                                typename Segment::IndexType chunk_size,
+                                Func&& body)
+{
+  using diff_type = typename Segment::IndexType;
+  const diff_type len = seg.size();
+  const diff_type num_chunks =
+      len > 0 ? (len + chunk_size - 1) / chunk_size : 0;
+
+  if (Dynamic) {
+#pragma omp for schedule(dynamic) nowait
+    for (diff_type c = 0; c < num_chunks; ++c) {
+      const diff_type first = c * chunk_size;
+      const diff_type last = std::min(len, first + chunk_size);
+      body(RAJA::detail::range_chunk(seg, first, last));
+    }
+  } else {
+#pragma omp for schedule(static, 1) nowait
+    for (diff_type c = 0; c < num_chunks; ++c) {
+      const diff_type first = c * chunk_size;
+      const diff_type last = std::min(len, first + chunk_size);
+      body(RAJA::detail::range_chunk(seg, first, last));
+    }
+  }
+
+  if (!NoWait) {
+#pragma omp barrier
+  }
+}
+
+//! Chunk size giving each thread of the team one contiguous block
+template <typename Segment>
+RAJA_INLINE typename Segment::IndexType ompBlockPerThread(Segment const& seg)
+{
+  using diff_type = typename Segment::IndexType;
+  const diff_type num_threads = omp_get_num_threads();
+  return std::max(diff_type(1),
+                  (seg.size() + num_threads - 1) / num_threads);
+}
+
+}  // namespace detail
+
+template <typename Segment, typename Func, typename InnerPolicy>
+RAJA_INLINE void forall_chunked_impl(const omp_parallel_exec<InnerPolicy>&,
+                                     Segment&& seg,
+                                     Func&& loop_body)
+{
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+    forall_chunked_impl(InnerPolicy{}, seg, body.get_priv());
+  });
+}
+
+//! One block per thread, as with the static schedule of omp for
+template <typename Segment, typename Func>
+RAJA_INLINE void forall_chunked_impl(const omp_for_exec&,
+                                     Segment&& seg,
+                                     Func&& loop_body)
+{
+  detail::omp_for_chunks<false, false>(
+      seg, detail::ompBlockPerThread(seg), loop_body);
+}
+
+template <typename Segment, typename Func>
+RAJA_INLINE void forall_chunked_impl(const omp_for_nowait_exec&,
+                                     Segment&& seg,
+                                     Func&& loop_body)
+{
+  detail::omp_for_chunks<false, true>(
+      seg, detail::ompBlockPerThread(seg), loop_body);
+}
+
+//! Chunks of ChunkSize dealt round-robin, as with schedule(static, ChunkSize)
+template <typename Segment, typename Func, unsigned int ChunkSize>
+RAJA_INLINE void forall_chunked_impl(const omp_for_static<ChunkSize>&,
+                                     Segment&& seg,
+                                     Func&& loop_body)
+{
+  using diff_type = typename camp::decay<Segment>::IndexType;
+  detail::omp_for_chunks<false, false>(
+      seg,
+      ChunkSize > 0 ? static_cast<diff_type>(ChunkSize)
+                    : detail::ompBlockPerThread(seg),
+      loop_body);
+}
+
+//! Chunks of ChunkSize handed out on demand; 0 picks several per thread
+template <typename Segment, typename Func, unsigned int ChunkSize>
+RAJA_INLINE void forall_chunked_impl(const omp_for_dynamic<ChunkSize>&,
+                                     Segment&& seg,
+                                     Func&& loop_body)
+{
+  using diff_type = typename camp::decay<Segment>::IndexType;
+  detail::omp_for_chunks<true, false>(
+      seg,
+      detail::taskloopGrainSize<ChunkSize>(diff_type(seg.size())),
+      loop_body);
+}
+
+//! Each block of BlockSize indices is a chunk, on the thread that owns it
+template <typename Segment, typename Func, size_t BlockSize, bool Pin>
+RAJA_INLINE void forall_chunked_impl(
+    const omp_affinity_static_exec<BlockSize, Pin>&,
+    Segment&& seg,
+    Func&& loop_body)
+{
+  using diff_type = typename camp::decay<Segment>::IndexType;
+  const long long len = static_cast<long long>(seg.size());
+  if (len <= 0) return;
+
+  const long long key_first = detail::affinityKeyBase(seg);
+  const long long block = static_cast<long long>(BlockSize);
+  const long long first_block = detail::floorDiv(key_first, block);
+  const long long last_block =
+      detail::floorDiv(key_first + len - 1, block) + 1;
+
+  // with blocks of one key, block number b runs on thread b % T as well
+  auto chunk_seg = camp::decay<Segment>(seg);
+  forall_impl(omp_affinity_static_exec<1, Pin>{},
+              TypedRangeSegment<long long>(first_block, last_block),
+              [=](long long b) {
+                const long long lo = std::max(key_first, b * block);
+                const long long hi = std::min(key_first + len, (b + 1) * block);
+                loop_body(RAJA::detail::range_chunk(
+                    chunk_seg,
+                    static_cast<diff_type>(lo - key_first),
+                    static_cast<diff_type>(hi - key_first)));
+              });
+}
+
+///
+/// Implementations with reduction parameters; see RAJA::forall_param
+///
+
+namespace detail
+{
+
+/*!
+ * \brief True for a single parameter whose operator OpenMP can reduce
+ *        natively, so a reduction clause combines the accumulators.
+ */
+template <typename... Params>
+struct is_native_param : std::false_type {
+};
+
+template <typename T, template <typename...> class Op>
+struct is_native_param<RAJA::detail::ReduceParam<T, Op>>
+    : impl::transform_reduce::detail::is_native_reduction<
+          T,
+          typename RAJA::detail::ReduceParam<T, Op>::op_type> {
+};
+
+//! Runs one thread's share of iter with acc as its accumulators
+template <typename InnerPolicy, typename Iterable, typename Func, typename Acc>
+RAJA_INLINE void ompParamThread(Iterable&& iter,
+                                Func const& loop_body,
+                                Acc& acc)
+{
+  auto values = camp::forward_as_tuple(acc);
+  forall_impl(InnerPolicy{},
+              iter,
+              RAJA::detail::makeForallParamBody(loop_body, values));
+}
+
+//! OpenMP reduction clause for operators::plus
+template <typename InnerPolicy, typename Iterable, typename Func, typename T>
+RAJA_INLINE T ompParamNative(Iterable&& iter,
+                             Func const& loop_body,
+                             T result,
+                             operators::plus<T>)
+{
+#pragma omp parallel reduction(+ : result)
+  ompParamThread<InnerPolicy>(iter, loop_body, result);
+  return result;
+}
+
+//! OpenMP reduction clause for operators::multiplies
+template <typename InnerPolicy, typename Iterable, typename Func, typename T>
+RAJA_INLINE T ompParamNative(Iterable&& iter,
+                             Func const& loop_body,
+                             T result,
+                             operators::multiplies<T>)
+{
+#pragma omp parallel reduction(* : result)
+  ompParamThread<InnerPolicy>(iter, loop_body, result);
+  return result;
+}
+
+//! OpenMP reduction clause for operators::minimum
+template <typename InnerPolicy, typename Iterable, typename Func, typename T>
+RAJA_INLINE T ompParamNative(Iterable&& iter,
+                             Func const& loop_body,
+                             T result,
+                             operators::minimum<T>)
+{
+#pragma omp parallel reduction(min : result)
+  ompParamThread<InnerPolicy>(iter, loop_body, result);
+  return result;
+}
+
+//! OpenMP reduction clause for operators::maximum
+template <typename InnerPolicy, typename Iterable, typename Func, typename T>
+RAJA_INLINE T ompParamNative(Iterable&& iter,
+                             Func const& loop_body,
+                             T result,
+                             operators::maximum<T>)
+{
+#pragma omp parallel reduction(max : result)
+  ompParamThread<InnerPolicy>(iter, loop_body, result);
+  return result;
+}
+
+//! A single native parameter: the reduction clause's private copy of the
+//! target is the accumulator of each thread
+template <typename InnerPolicy,
+          typename Iterable,
+          typename Func,
+          typename T,
+          template <typename...> class Op>
+RAJA_INLINE void ompParam(
+    Iterable&& iter,
+    Func const& loop_body,
+    RAJA::detail::ForallParamPack<RAJA::detail::ReduceParam<T, Op>> const&
+        params,
+    std::true_type)
+{
+  T& target = *camp::get<0>(params.params).target;
+  target = ompParamNative<InnerPolicy>(
+      iter,
+      loop_body,
+      target,
+      typename RAJA::detail::ReduceParam<T, Op>::op_type{});
+}
+
+//! Any other parameters: one set of accumulators per thread, alone on its
+//! cache line, folded in thread order
+template <typename InnerPolicy,
+          typename Iterable,
+          typename Func,
+          typename... Params>
+RAJA_INLINE void ompParam(
+    Iterable&& iter,
+    Func const& loop_body,
+    RAJA::detail::ForallParamPack<Params...> const& params,
+    std::false_type)
+{
+  using values_type =
+      typename RAJA::detail::ForallParamPack<Params...>::values_type;
+  using impl::transform_reduce::detail::BlockPartial;
+
+  std::vector<BlockPartial<values_type>> partials(omp_get_max_threads());
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    BlockPartial<values_type>& partial = partials[omp_get_thread_num()];
+    partial.value = params.identities();
+    partial.valid = true;
+    forall_impl(InnerPolicy{},
+                iter,
+                RAJA::detail::makeForallParamBody(loop_body, partial.value));
+  });
+
+  values_type result = params.identities();
+  for (BlockPartial<values_type> const& partial : partials) {
+    if (partial.valid) {
+      params.combine(result, partial.value);
+    }
+  }
+  params.finalize(result);
+}
+
+}  // namespace detail
+
+/*!
+ * The loop body is shared by the team rather than copied per thread.  Each
+ * thread accumulates into its own values under the schedule of InnerPolicy.
+ */
+template <typename Iterable,
+          typename Func,
+          typename InnerPolicy,
+          typename... Params>
+RAJA_INLINE void forall_param_impl(
+    const omp_parallel_exec<InnerPolicy>&,
+    Iterable&& iter,
+    RAJA::detail::ForallParamPack<Params...> const& params,
+    Func&& loop_body)
+{
+  detail::ompParam<InnerPolicy>(iter,
+                                loop_body,
+                                params,
+                                detail::is_native_param<Params...>{});
+}
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -126,67 +679,128 @@ RAJA_INLINE void forall_impl(const omp_for_static<ChunkSize>&,
 //////////////////////////////////////////////////////////////////////
 //
 
+namespace detail
+{
+
+template <typename IndexSetT>
+RAJA_INLINE void check_dependency_graph(IndexSetT const& iset)
+{
+  if (!iset.dependencyGraphSet()) {
+    std::cerr << "\n RAJA IndexSet dependency graph not set , "
+              << "FILE: " << __FILE__ << " line: " << __LINE__ << std::endl;
+    RAJA_ABORT_OR_THROW("IndexSet dependency graph");
+  }
+}
+
+/*!
+ * \brief Execute segment seg, then release the segments depending on it.
+ *
+ * Each dependent segment is spawned as a task by the thread satisfying its
+ * last dependency, so segments start as soon as they are ready.
+ */
+template <typename IndexSetT, typename Func>
+void taskgraph_execute_segment(IndexSetT const* iset, Func const* body, int seg)
+{
+  {
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(*body);
+    privatizer.get_priv()(seg);
+  }
+
+  DepGraphNode& task = iset->getDepGraphNode(seg);
+  task.reset();
+
+  for (int ii = 0; ii < task.numDepTasks(); ++ii) {
+    const int dep = task.depTaskNum(ii);
+    if (iset->getDepGraphNode(dep).satisfyOne()) {
+#pragma omp task firstprivate(dep)
+      taskgraph_execute_segment(iset, body, dep);
+    }
+  }
+}
+
+}  // namespace detail
+
 /*!
  ******************************************************************************
  *
- * \brief  Iterate over index set segments using an omp parallel loop and
- *         segment dependency graph. Individual segment execution will use
- *         execution policy template parameter.
+ * \brief  Iterate over index set segments as OpenMP tasks ordered by the
+ *         segment dependency graph of the index set.
+ *
+ *         Segments with no dependencies are started first; every other
+ *         segment is started by the thread completing its last dependency.
+ *         There are no barriers between segments, and any acyclic graph
+ *         may be used.
  *
  *         This method assumes that a task dependency graph has been
- *         properly set up for each segment in the index set.
+ *         properly set up for each segment in the index set; see
+ *         TypedIndexSet::addSegmentDependency.
  *
  ******************************************************************************
  */
+template <typename Iterable, typename Func>
+RAJA_INLINE void forall_impl(const omp_taskgraph_segit&,
+                             Iterable&& iset,
+                             Func&& loop_body)
+{
+  const int num_seg = iset.getNumSegments();
+  if (num_seg == 0) return;
+
+  detail::check_dependency_graph(iset);
+
+  auto const* iset_ptr = &iset;
+  auto const* body_ptr = &loop_body;
+  detail::omp_taskloop_region([=]() {
+    for (int seg = 0; seg < num_seg; ++seg) {
+      if (iset_ptr->getDepGraphNode(seg).semaphoreReloadValue() == 0) {
+#pragma omp task firstprivate(seg)
+        detail::taskgraph_execute_segment(iset_ptr, body_ptr, seg);
+      }
+    }
+  });
+}
 
-/*
- * TODO: Fix this!!!
+/*!
+ ******************************************************************************
+ *
+ * \brief  Iterate over index set segments in an omp parallel loop that
+ *         deals segments to threads round-robin, each thread waiting only
+ *         on the dependencies of its next segment.
+ *
+ *         Avoids the cost of creating tasks, but requires every dependency
+ *         to point from a lower-numbered segment to a higher-numbered one.
+ *
+ ******************************************************************************
  */
-
-/*
-template <typename SEG_EXEC_POLICY_T, typename LOOP_BODY, typename ...
-SEG_TYPES>
-RAJA_INLINE void forall(
-    ExecPolicy<omp_taskgraph_segit, SEG_EXEC_POLICY_T>,
-    const IndexSet<SEG_TYPES ...>& iset,
-    LOOP_BODY loop_body)
+template <typename Iterable, typename Func>
+RAJA_INLINE void forall_impl(const omp_taskgraph_interval_segit&,
+                             Iterable&& iset,
+                             Func&& loop_body)
 {
-  if (!iset.dependencyGraphSet()) {
-    std::cerr << "\n RAJA IndexSet dependency graph not set , "
-              << "FILE: " << __FILE__ << " line: " << __LINE__ << std::endl;
-    RAJA_ABORT_OR_THROW("IndexSet dependency graph");
-  }
-
-  IndexSet& ncis = (*const_cast<IndexSet*>(&iset));
+  const int num_seg = iset.getNumSegments();
+  if (num_seg == 0) return;
 
-  int num_seg = ncis.getNumSegments();
+  detail::check_dependency_graph(iset);
 
 #pragma omp parallel for schedule(static, 1)
-  for (int isi = 0; isi < num_seg; ++isi) {
-    IndexSetSegInfo* seg_info = ncis.getSegmentInfo(isi);
-    DepGraphNode* task = seg_info->getDepGraphNode();
+  for (int seg = 0; seg < num_seg; ++seg) {
+    DepGraphNode& task = iset.getDepGraphNode(seg);
 
-    task->wait();
+    task.wait();
 
-    executeRangeList_forall<SEG_EXEC_POLICY_T>(seg_info, loop_body);
+    {
+      using RAJA::internal::thread_privatize;
+      auto privatizer = thread_privatize(loop_body);
+      privatizer.get_priv()(seg);
+    }
 
-    task->reset();
+    task.reset();
 
-    if (task->numDepTasks() != 0) {
-      for (int ii = 0; ii < task->numDepTasks(); ++ii) {
-        // Alternateively, we could get the return value of this call
-        // and actively launch the task if we are the last depedent
-        // task. In that case, we would not need the semaphore spin
-        // loop above.
-        int seg = task->depTaskNum(ii);
-        DepGraphNode* dep = ncis.getSegmentInfo(seg)->getDepGraphNode();
-        dep->satisfyOne();
-      }
+    for (int ii = 0; ii < task.numDepTasks(); ++ii) {
+      iset.getDepGraphNode(task.depTaskNum(ii)).satisfyOne();
     }
-
   }  // iterate over segments of index set
 }
-*/
 
 }  // namespace omp
 
@@ -0,0 +1,105 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA histogram declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_histogram_openmp_HPP
+#define RAJA_histogram_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#include <omp.h>
+
+#include <type_traits>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/detail/histogram.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/sort.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace histogram
+{
+
+/*!
+        \brief add weight(i) to bins[keys[i]] for each i in [0, n)
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename WeightFn,
+          typename BinIter>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>> histogram(
+    const ExecPolicy&,
+    KeyIter keys,
+    Index_type n,
+    WeightFn weight,
+    BinIter bins,
+    Index_type num_bins)
+{
+  detail::histogramEngine(sort::detail::OmpForBlocks{},
+                          omp_get_max_threads(),
+                          keys,
+                          n,
+                          weight,
+                          bins,
+                          num_bins);
+}
+
+/*!
+        \brief reduce every run of equal keys of the n keys at keys with op;
+   returns the number of runs
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename KeyOut,
+          typename ValOut,
+          typename BinFn,
+          typename Predicate>
+typename std::enable_if<type_traits::is_openmp_policy<ExecPolicy>::value,
+                        Index_type>::type
+reduce_by_key(const ExecPolicy&,
+              KeyIter keys,
+              Index_type n,
+              ValIter vals,
+              KeyOut keys_out,
+              ValOut vals_out,
+              BinFn op,
+              Predicate pred)
+{
+  return detail::reduceByKeyEngine(sort::detail::OmpForBlocks{},
+                                   omp_get_max_threads(),
+                                   keys,
+                                   n,
+                                   vals,
+                                   keys_out,
+                                   vals_out,
+                                   op,
+                                   pred);
+}
+
+}  // namespace histogram
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
@@ -22,6 +22,8 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
+#include <omp.h>
+
 #include "RAJA/pattern/detail/privatizer.hpp"
 
 #include "RAJA/pattern/kernel/Collapse.hpp"
@@ -30,6 +32,7 @@
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/policy/openmp/forall.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
 
 
@@ -48,9 +51,89 @@ struct omp_parallel_collapse_exec
                             RAJA::policy::omp::For> {
 };
 
+/*!
+ * Collapsed loops run with the given schedule, one of
+ * RAJA::policy::omp::Dynamic<N>, Guided<N> or Runtime.
+ */
+template <typename Schedule>
+struct omp_parallel_collapse_sched_exec
+    : make_policy_pattern_t<RAJA::Policy::openmp,
+                            RAJA::Pattern::forall,
+                            RAJA::policy::omp::For,
+                            Schedule> {
+};
+
+template <unsigned int ChunkSize = 0>
+using omp_parallel_collapse_dynamic_exec =
+    omp_parallel_collapse_sched_exec<RAJA::policy::omp::Dynamic<ChunkSize>>;
+
+template <unsigned int ChunkSize = 0>
+using omp_parallel_collapse_guided_exec =
+    omp_parallel_collapse_sched_exec<RAJA::policy::omp::Guided<ChunkSize>>;
+
+using omp_parallel_collapse_runtime_exec =
+    omp_parallel_collapse_sched_exec<RAJA::policy::omp::Runtime>;
+
+/*!
+ * Collapsed loops split into OpenMP tasks of about GrainSize iterations; see
+ * RAJA::omp_taskloop_exec.
+ */
+template <unsigned int GrainSize = 0>
+struct omp_taskloop_collapse_exec
+    : make_policy_pattern_t<RAJA::Policy::openmp,
+                            RAJA::Pattern::forall,
+                            RAJA::policy::omp::Taskloop<GrainSize>> {
+};
+
 namespace internal
 {
 
+/*!
+ * Sets the run-sched-var ICV of the calling thread for the lifetime of the
+ * object, so that a "schedule(runtime)" loop in a parallel region it starts
+ * uses Schedule.  The previous setting is restored on destruction.
+ */
+template <typename Schedule>
+struct ScopedOmpSchedule;
+
+#if !defined(RAJA_COMPILER_MSVC)
+template <typename Schedule, omp_sched_t Kind>
+struct ScopedOmpScheduleBase {
+  omp_sched_t prev_kind;
+  int prev_chunk;
+
+  ScopedOmpScheduleBase()
+  {
+    omp_get_schedule(&prev_kind, &prev_chunk);
+    // a chunk size below 1 selects the implementation default
+    omp_set_schedule(Kind, static_cast<int>(Schedule::value));
+  }
+
+  ~ScopedOmpScheduleBase() { omp_set_schedule(prev_kind, prev_chunk); }
+};
+
+template <unsigned int ChunkSize>
+struct ScopedOmpSchedule<RAJA::policy::omp::Dynamic<ChunkSize>>
+    : ScopedOmpScheduleBase<RAJA::policy::omp::Dynamic<ChunkSize>,
+                            omp_sched_dynamic> {
+};
+
+template <unsigned int ChunkSize>
+struct ScopedOmpSchedule<RAJA::policy::omp::Guided<ChunkSize>>
+    : ScopedOmpScheduleBase<RAJA::policy::omp::Guided<ChunkSize>,
+                            omp_sched_guided> {
+};
+#else
+// OpenMP 2.0 has no omp_set_schedule; fall back to the runtime schedule
+template <typename Schedule>
+struct ScopedOmpSchedule {
+};
+#endif
+
+template <>
+struct ScopedOmpSchedule<RAJA::policy::omp::Runtime> {
+};
+
 /////////
 // Collapsing two loops
 /////////
@@ -124,6 +207,105 @@ struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
     for (i0 = 0; i0 < l0; ++i0) {
       for (i1 = 0; i1 < l1; ++i1) {
         for (i2 = 0; i2 < l2; ++i2) {
+          RAJA::policy::omp::detail::OmpTaskloopTaskScope task_scope;
+          auto& private_data = privatizer.get_priv();
+          private_data.template assign_offset<Arg0>(i0);
+          private_data.template assign_offset<Arg1>(i1);
+          private_data.template assign_offset<Arg2>(i2);
+          execute_statement_list<camp::list<EnclosedStmts...>, NewTypes2>(private_data);
+        }
+      }
+    }
+  }
+};
+
+
+/////////
+// Collapsing loops with a dynamic, guided or runtime schedule
+/////////
+
+template <typename Schedule,
+          camp::idx_t Arg0,
+          camp::idx_t Arg1,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Collapse<omp_parallel_collapse_sched_exec<Schedule>,
+                        ArgList<Arg0, Arg1>,
+                        EnclosedStmts...>,
+    Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    const auto l0 = segment_length<Arg0>(data);
+    const auto l1 = segment_length<Arg1>(data);
+    auto i0 = l0;
+    auto i1 = l1;
+
+    // Set the argument types for this loop
+    using NewTypes0 = setSegmentTypeFromData<Types, Arg0, Data>;
+    using NewTypes1 = setSegmentTypeFromData<NewTypes0, Arg1, Data>;
+
+    ScopedOmpSchedule<Schedule> schedule;
+    RAJA_UNUSED_VAR(schedule);
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(data);
+#pragma omp parallel for private(i0, i1) firstprivate(privatizer) \
+    schedule(runtime) RAJA_COLLAPSE(2)
+    for (i0 = 0; i0 < l0; ++i0) {
+      for (i1 = 0; i1 < l1; ++i1) {
+        auto& private_data = privatizer.get_priv();
+        private_data.template assign_offset<Arg0>(i0);
+        private_data.template assign_offset<Arg1>(i1);
+        execute_statement_list<camp::list<EnclosedStmts...>, NewTypes1>(private_data);
+      }
+    }
+  }
+};
+
+
+template <typename Schedule,
+          camp::idx_t Arg0,
+          camp::idx_t Arg1,
+          camp::idx_t Arg2,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Collapse<omp_parallel_collapse_sched_exec<Schedule>,
+                        ArgList<Arg0, Arg1, Arg2>,
+                        EnclosedStmts...>,
+    Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    const auto l0 = segment_length<Arg0>(data);
+    const auto l1 = segment_length<Arg1>(data);
+    const auto l2 = segment_length<Arg2>(data);
+    auto i0 = l0;
+    auto i1 = l1;
+    auto i2 = l2;
+
+    // Set the argument types for this loop
+    using NewTypes0 = setSegmentTypeFromData<Types, Arg0, Data>;
+    using NewTypes1 = setSegmentTypeFromData<NewTypes0, Arg1, Data>;
+    using NewTypes2 = setSegmentTypeFromData<NewTypes1, Arg2, Data>;
+
+    ScopedOmpSchedule<Schedule> schedule;
+    RAJA_UNUSED_VAR(schedule);
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(data);
+#pragma omp parallel for private(i0, i1, i2) firstprivate(privatizer) \
+    schedule(runtime) RAJA_COLLAPSE(3)
+    for (i0 = 0; i0 < l0; ++i0) {
+      for (i1 = 0; i1 < l1; ++i1) {
+        for (i2 = 0; i2 < l2; ++i2) {
+          RAJA::policy::omp::detail::OmpTaskloopTaskScope task_scope;
           auto& private_data = privatizer.get_priv();
           private_data.template assign_offset<Arg0>(i0);
           private_data.template assign_offset<Arg1>(i1);
@@ -136,6 +318,110 @@ struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
 };
 
 
+/////////
+// Collapsing loops into OpenMP tasks
+/////////
+
+template <unsigned int GrainSize,
+          camp::idx_t Arg0,
+          camp::idx_t Arg1,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Collapse<omp_taskloop_collapse_exec<GrainSize>,
+                        ArgList<Arg0, Arg1>,
+                        EnclosedStmts...>,
+    Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    const auto l0 = segment_length<Arg0>(data);
+    const auto l1 = segment_length<Arg1>(data);
+
+    // Set the argument types for this loop
+    using NewTypes0 = setSegmentTypeFromData<Types, Arg0, Data>;
+    using NewTypes1 = setSegmentTypeFromData<NewTypes0, Arg1, Data>;
+
+    RAJA::policy::omp::detail::omp_taskloop_region([&]() {
+      auto i0 = l0;
+      auto i1 = l1;
+      const auto grain =
+          RAJA::policy::omp::detail::taskloopGrainSize<GrainSize>(l0 * l1);
+
+      using RAJA::internal::thread_privatize;
+      auto privatizer = thread_privatize(data);
+#pragma omp taskloop private(i0, i1) firstprivate(privatizer) \
+    grainsize(grain) RAJA_COLLAPSE(2)
+      for (i0 = 0; i0 < l0; ++i0) {
+        for (i1 = 0; i1 < l1; ++i1) {
+          RAJA::policy::omp::detail::OmpTaskloopTaskScope task_scope;
+          auto& private_data = privatizer.get_priv();
+          private_data.template assign_offset<Arg0>(i0);
+          private_data.template assign_offset<Arg1>(i1);
+          execute_statement_list<camp::list<EnclosedStmts...>, NewTypes1>(private_data);
+        }
+      }
+    });
+  }
+};
+
+
+template <unsigned int GrainSize,
+          camp::idx_t Arg0,
+          camp::idx_t Arg1,
+          camp::idx_t Arg2,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Collapse<omp_taskloop_collapse_exec<GrainSize>,
+                        ArgList<Arg0, Arg1, Arg2>,
+                        EnclosedStmts...>,
+    Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    const auto l0 = segment_length<Arg0>(data);
+    const auto l1 = segment_length<Arg1>(data);
+    const auto l2 = segment_length<Arg2>(data);
+
+    // Set the argument types for this loop
+    using NewTypes0 = setSegmentTypeFromData<Types, Arg0, Data>;
+    using NewTypes1 = setSegmentTypeFromData<NewTypes0, Arg1, Data>;
+    using NewTypes2 = setSegmentTypeFromData<NewTypes1, Arg2, Data>;
+
+    RAJA::policy::omp::detail::omp_taskloop_region([&]() {
+      auto i0 = l0;
+      auto i1 = l1;
+      auto i2 = l2;
+      const auto grain =
+          RAJA::policy::omp::detail::taskloopGrainSize<GrainSize>(l0 * l1 *
+                                                                  l2);
+
+      using RAJA::internal::thread_privatize;
+      auto privatizer = thread_privatize(data);
+#pragma omp taskloop private(i0, i1, i2) firstprivate(privatizer) \
+    grainsize(grain) RAJA_COLLAPSE(3)
+      for (i0 = 0; i0 < l0; ++i0) {
+        for (i1 = 0; i1 < l1; ++i1) {
+          for (i2 = 0; i2 < l2; ++i2) {
+            RAJA::policy::omp::detail::OmpTaskloopTaskScope task_scope;
+            auto& private_data = privatizer.get_priv();
+            private_data.template assign_offset<Arg0>(i0);
+            private_data.template assign_offset<Arg1>(i1);
+            private_data.template assign_offset<Arg2>(i2);
+            execute_statement_list<camp::list<EnclosedStmts...>, NewTypes2>(private_data);
+          }
+        }
+      }
+    });
+  }
+};
+
+
 
 
 
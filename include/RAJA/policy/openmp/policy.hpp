@@ -18,6 +18,7 @@
 #ifndef policy_openmp_HPP
 #define policy_openmp_HPP
 
+#include <cstddef>
 #include <type_traits>
 
 #include "RAJA/policy/PolicyBase.hpp"
@@ -46,6 +47,30 @@ template <unsigned int ChunkSize>
 struct Static : std::integral_constant<unsigned int, ChunkSize> {
 };
 
+//! A ChunkSize of 0 leaves the chunk size to the OpenMP implementation
+template <unsigned int ChunkSize>
+struct Dynamic : std::integral_constant<unsigned int, ChunkSize> {
+};
+
+//! A ChunkSize of 0 leaves the minimum chunk size to the OpenMP implementation
+template <unsigned int ChunkSize>
+struct Guided : std::integral_constant<unsigned int, ChunkSize> {
+};
+
+//! Schedule chosen at run time from OMP_SCHEDULE or omp_set_schedule()
+struct Runtime {
+};
+
+//! A GrainSize of 0 lets RAJA pick the number of iterations per task
+template <unsigned int GrainSize>
+struct Taskloop : std::integral_constant<unsigned int, GrainSize> {
+};
+
+//! Blocks of BlockSize index values dealt round-robin to the team's threads
+template <size_t BlockSize, bool Pin>
+struct AffinityStatic : std::integral_constant<size_t, BlockSize> {
+};
+
 
 //
 //////////////////////////////////////////////////////////////////////
@@ -84,6 +109,33 @@ struct omp_for_static : make_policy_pattern_launch_platform_t<Policy::openmp,
                                                               omp::Static<N>> {
 };
 
+template <unsigned int N = 0>
+struct omp_for_dynamic
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::For,
+                                            omp::Dynamic<N>> {
+};
+
+template <unsigned int N = 0>
+struct omp_for_guided : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                                              Pattern::forall,
+                                                              Launch::undefined,
+                                                              Platform::host,
+                                                              omp::For,
+                                                              omp::Guided<N>> {
+};
+
+struct omp_for_runtime : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                                               Pattern::forall,
+                                                               Launch::undefined,
+                                                               Platform::host,
+                                                               omp::For,
+                                                               omp::Runtime> {
+};
+
 
 template <typename InnerPolicy>
 struct omp_parallel_exec
@@ -102,6 +154,50 @@ template <unsigned int N>
 struct omp_parallel_for_static : omp_parallel_exec<omp_for_static<N>> {
 };
 
+template <unsigned int N = 0>
+struct omp_parallel_for_dynamic : omp_parallel_exec<omp_for_dynamic<N>> {
+};
+
+template <unsigned int N = 0>
+struct omp_parallel_for_guided : omp_parallel_exec<omp_for_guided<N>> {
+};
+
+struct omp_parallel_for_runtime : omp_parallel_exec<omp_for_runtime> {
+};
+
+///
+/// Split the loop into OpenMP tasks of about GrainSize iterations.  Called
+/// inside a parallel region, the calling thread generates the tasks and the
+/// whole team executes them; otherwise a parallel region is created.
+///
+template <unsigned int GrainSize = 0>
+struct omp_taskloop_exec
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::Taskloop<GrainSize>> {
+};
+
+///
+/// Static schedule whose index-to-thread mapping depends only on the index
+/// values and the team size: index i runs on thread (i / BlockSize) % T.
+/// Loops over different ranges therefore touch each index from the same
+/// thread, which is what makes first-touch page placement (see
+/// RAJA::omp_affinity_allocate) pay off.  With Pin the parallel region uses
+/// proc_bind(close) so that thread t stays on the t-th OpenMP place.
+///
+template <size_t BlockSize = 2048, bool Pin = false>
+struct omp_affinity_static_exec
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::AffinityStatic<BlockSize,
+                                                                Pin>> {
+  static_assert(BlockSize > 0, "omp_affinity_static_exec needs BlockSize > 0");
+};
+
 
 ///
 /// Index set segment iteration policies
@@ -111,6 +207,13 @@ using omp_parallel_for_segit = omp_parallel_for_exec;
 
 using omp_parallel_segit = omp_parallel_for_segit;
 
+//! hand segments out one at a time, for index sets with uneven segments
+using omp_parallel_for_dynamic_segit = omp_parallel_for_dynamic<1>;
+
+using omp_parallel_for_guided_segit = omp_parallel_for_guided<>;
+
+using omp_parallel_for_runtime_segit = omp_parallel_for_runtime;
+
 struct omp_taskgraph_segit
     : make_policy_pattern_t<Policy::openmp, Pattern::taskgraph, omp::Parallel> {
 };
@@ -134,6 +237,11 @@ struct omp_reduce_ordered
     : make_policy_pattern_t<Policy::openmp, Pattern::reduce, reduce::ordered> {
 };
 
+struct omp_reduce_reproducible : make_policy_pattern_t<Policy::openmp,
+                                                       Pattern::reduce,
+                                                       reduce::reproducible> {
+};
+
 struct omp_synchronize : make_policy_pattern_launch_t<Policy::openmp,
                                                       Pattern::synchronize,
                                                       Launch::sync> {
@@ -142,17 +250,29 @@ struct omp_synchronize : make_policy_pattern_launch_t<Policy::openmp,
 }  // namespace omp
 }  // namespace policy
 
+using policy::omp::omp_for_dynamic;
 using policy::omp::omp_for_exec;
+using policy::omp::omp_for_guided;
 using policy::omp::omp_for_nowait_exec;
+using policy::omp::omp_for_runtime;
 using policy::omp::omp_for_static;
 using policy::omp::omp_parallel_exec;
+using policy::omp::omp_parallel_for_dynamic;
+using policy::omp::omp_parallel_for_dynamic_segit;
 using policy::omp::omp_parallel_for_exec;
+using policy::omp::omp_parallel_for_guided;
+using policy::omp::omp_parallel_for_guided_segit;
+using policy::omp::omp_parallel_for_runtime;
+using policy::omp::omp_parallel_for_runtime_segit;
 using policy::omp::omp_parallel_for_segit;
 using policy::omp::omp_parallel_region;
 using policy::omp::omp_parallel_segit;
 using policy::omp::omp_reduce;
 using policy::omp::omp_reduce_ordered;
+using policy::omp::omp_reduce_reproducible;
 using policy::omp::omp_synchronize;
+using policy::omp::omp_taskloop_exec;
+using policy::omp::omp_affinity_static_exec;
 
 
 
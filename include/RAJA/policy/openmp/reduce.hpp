@@ -33,6 +33,7 @@
 #include "RAJA/util/types.hpp"
 
 #include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/detail/reduce_reproducible.hpp"
 #include "RAJA/pattern/reduce.hpp"
 
 #include "RAJA/policy/openmp/policy.hpp"
@@ -42,30 +43,98 @@ namespace RAJA
 
 namespace detail
 {
+
+//! One thread's share of an OpenMP reducer, alone on its cache line
+template <typename T>
+struct alignas(64) ReduceOMPSlot {
+  T value;
+};
+
+/*!
+ * \brief True when omp_get_thread_num() names the calling thread uniquely,
+ *        inside one active, non-nested team.  Threads of other back-ends
+ *        and serial code also see thread number 0, so they must lock.
+ */
+RAJA_INLINE bool ompSlotIsPrivate()
+{
+  return omp_get_level() == 1 && omp_in_parallel();
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  OpenMP reducer combiner.
+ *
+ *         The reducer object the user declares owns one padded slot per
+ *         OpenMP thread.  Each thread-private copy folds its value into the
+ *         slot of its thread when it is destroyed, so copies never contend
+ *         and no lock is taken.  get() folds the slots, in thread order,
+ *         into the owner.  Copies destroyed outside a single active
+ *         OpenMP team, in nested regions, serial code or the workers of
+ *         other back-ends, fall back to a critical section.
+ *
+ ******************************************************************************
+ */
 template <typename T, typename Reduce>
 class ReduceOMP
     : public reduce::detail::BaseCombinable<T, Reduce, ReduceOMP<T, Reduce>>
 {
   using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceOMP>;
+  using Slot = ReduceOMPSlot<T>;
+
+  //! per-thread slots; only allocated in the reducer that owns the result
+  std::vector<Slot> mutable slots;
 
 public:
-  using Base::Base;
   //! prohibit compiler-generated default ctor
   ReduceOMP() = delete;
 
+  ReduceOMP(T init_val, T identity_ = T())
+      : Base(init_val, identity_),
+        slots(omp_get_max_threads(), Slot{identity_})
+  {
+  }
+
+  //! copies point at the owner and carry no slots
+  ReduceOMP(ReduceOMP const &other) : Base(other) {}
+
+  void reset(T init_val, T identity_)
+  {
+    Base::reset(init_val, identity_);
+    slots.assign(omp_get_max_threads(), Slot{identity_});
+  }
+
   ~ReduceOMP()
   {
     if (Base::parent) {
+      auto const *owner = static_cast<ReduceOMP const *>(Base::parent);
+      const int tid = omp_get_thread_num();
+      if (ompSlotIsPrivate() &&
+          tid < static_cast<int>(owner->slots.size())) {
+        Reduce()(owner->slots[tid].value, Base::my_data);
+      } else {
 #pragma omp critical(ompReduceCritical)
-      Reduce()(Base::parent->local(), Base::my_data);
-      Base::my_data = Base::identity;
+        Reduce()(Base::parent->local(), Base::my_data);
+      }
+      Base::parent = nullptr;
+    }
+  }
+
+  T get_combined() const
+  {
+    for (Slot &slot : slots) {
+      Reduce()(Base::my_data, slot.value);
+      slot.value = Base::identity;
     }
+    return Base::my_data;
   }
 };
 
 }  // namespace detail
 
 RAJA_DECLARE_ALL_REDUCERS(omp_reduce, detail::ReduceOMP)
+RAJA_DECLARE_ARRAY_REDUCER(omp_reduce, detail::ReduceOMP)
+RAJA_DECLARE_GENERIC_REDUCER(omp_reduce, detail::ReduceOMP)
 
 ///////////////////////////////////////////////////////////////////////////////
 //
@@ -102,12 +171,12 @@ public:
   ~ReduceOMPOrdered()
   {
     Reduce{}((*data)[omp_get_thread_num()], Base::my_data);
-    Base::my_data = Base::identity;
+    Base::parent = nullptr;
   }
 
   T get_combined() const
   {
-    if (Base::my_data != Base::identity) {
+    if (reduce::detail::differs(Base::my_data, Base::identity, 0)) {
       Reduce{}((*data)[omp_get_thread_num()], Base::my_data);
       Base::my_data = Base::identity;
     }
@@ -123,6 +192,91 @@ public:
 }  // namespace detail
 
 RAJA_DECLARE_ALL_REDUCERS(omp_reduce_ordered, detail::ReduceOMPOrdered)
+RAJA_DECLARE_GENERIC_REDUCER(omp_reduce_ordered, detail::ReduceOMPOrdered)
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Reproducible reductions are included below.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  OpenMP reproducible reducer combiner.
+ *
+ *         Folds copies into per-thread slots like ReduceOMP, but the values
+ *         are reduce::detail::ReproducibleValues, so the result is bitwise
+ *         the same for any number of threads and any schedule.
+ *
+ ******************************************************************************
+ */
+template <typename T, typename Reduce>
+class ReduceOMPReproducible
+    : public reduce::detail::
+          BaseReproducible<T, Reduce, ReduceOMPReproducible<T, Reduce>>
+{
+  using Base = reduce::detail::
+      BaseReproducible<T, Reduce, ReduceOMPReproducible>;
+  using Accumulator = typename Base::Accumulator;
+  using Slot = ReduceOMPSlot<Accumulator>;
+
+  //! per-thread slots; only allocated in the reducer that owns the result
+  std::vector<Slot> mutable slots;
+
+public:
+  //! prohibit compiler-generated default ctor
+  ReduceOMPReproducible() = delete;
+
+  ReduceOMPReproducible(T init_val, T identity_ = T())
+      : Base(init_val, identity_),
+        slots(omp_get_max_threads(), Slot{Accumulator(identity_)})
+  {
+  }
+
+  //! copies point at the owner and carry no slots
+  ReduceOMPReproducible(ReduceOMPReproducible const &other) : Base(other) {}
+
+  void reset(T init_val, T identity_)
+  {
+    Base::reset(init_val, identity_);
+    slots.assign(omp_get_max_threads(), Slot{Accumulator(identity_)});
+  }
+
+  ~ReduceOMPReproducible()
+  {
+    if (Base::parent) {
+      auto const *owner =
+          static_cast<ReduceOMPReproducible const *>(Base::parent);
+      const int tid = omp_get_thread_num();
+      if (ompSlotIsPrivate() &&
+          tid < static_cast<int>(owner->slots.size())) {
+        owner->slots[tid].value.merge(Base::my_data);
+      } else {
+#pragma omp critical(ompReduceCritical)
+        Base::parent->accumulator().merge(Base::my_data);
+      }
+      Base::parent = nullptr;
+    }
+  }
+
+  T get_combined() const
+  {
+    for (Slot &slot : slots) {
+      Base::my_data.merge(slot.value);
+      slot.value = Accumulator(Base::identity);
+    }
+    return Base::my_data.get();
+  }
+};
+
+}  // namespace detail
+
+RAJA_DECLARE_ALL_REDUCERS(omp_reduce_reproducible,
+                          detail::ReduceOMPReproducible)
 
 }  // namespace RAJA
 
@@ -28,8 +28,11 @@
 
 #include <omp.h>
 
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/detail/scan.hpp"
+
 #include "RAJA/policy/openmp/policy.hpp"
-#include "RAJA/policy/loop/scan.hpp"
 
 namespace RAJA
 {
@@ -38,10 +41,85 @@ namespace impl
 namespace scan
 {
 
-RAJA_INLINE
-int firstIndex(int n, int p, int pid)
+namespace detail
+{
+
+/*!
+        \brief run a BlockScan with one block per thread of a single parallel
+   region; the only synchronization is the barrier between the two phases.
+   An empty range returns at once, since num_threads(0) is not allowed
+*/
+template <typename Scan>
+void ompBlockScan(Index_type n, Scan scan)
 {
-  return (static_cast<size_t>(n) * pid) / p;
+  if (n <= 0) {
+    return;
+  }
+  const Index_type p0 =
+      std::min(n, static_cast<Index_type>(omp_get_max_threads()));
+  ::std::vector<typename Scan::total_type> sums(p0);
+  scan.sums = sums.data();
+#pragma omp parallel num_threads(p0)
+  {
+    const Index_type p = omp_get_num_threads();
+    const Index_type pid = omp_get_thread_num();
+    if (pid < p - 1) {
+      scan.reduce(pid, p);
+    }
+#pragma omp barrier
+    scan.scan(pid, p);
+  }
+}
+
+}  // namespace detail
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   unary operation applied to each input element
+*/
+template <typename Policy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename UnaryFn>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> transform_inclusive(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f,
+    UnaryFn op)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  const Index_type n = end - begin;
+  detail::ompBlockScan(
+      n, detail::makeBlockScan<true>(begin, out, n, f, op, Value()));
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function,
+   unary operation applied to each input element, and initial value
+*/
+template <typename Policy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename UnaryFn,
+          typename ValueT>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> transform_exclusive(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f,
+    UnaryFn op,
+    ValueT v)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  const Index_type n = end - begin;
+  detail::ompBlockScan(
+      n,
+      detail::makeBlockScan<false>(begin, out, n, f, op, static_cast<Value>(v)));
 }
 
 /*!
@@ -56,25 +134,11 @@ concepts::enable_if<type_traits::is_openmp_policy<Policy>> inclusive_inplace(
     BinFn f)
 {
   using Value = typename ::std::iterator_traits<Iter>::value_type;
-  const int n = end - begin;
-  const int p0 = std::min(n, omp_get_max_threads());
-  ::std::vector<Value> sums(p0, Value());
-#pragma omp parallel num_threads(p0)
-  {
-    const int p = omp_get_num_threads();
-    const int pid = omp_get_thread_num();
-    const int i0 = firstIndex(n, p, pid);
-    const int i1 = firstIndex(n, p, pid + 1);
-    inclusive_inplace(::RAJA::loop_exec{}, begin + i0, begin + i1, f);
-    sums[pid] = *(begin + i1 - 1);
-#pragma omp barrier
-#pragma omp single
-    exclusive_inplace(
-        ::RAJA::loop_exec{}, sums.data(), sums.data() + p, f, BinFn::identity());
-    for (int i = i0; i < i1; ++i) {
-      *(begin + i) = f(*(begin + i), sums[pid]);
-    }
-  }
+  const Index_type n = end - begin;
+  detail::ompBlockScan(
+      n,
+      detail::makeBlockScan<true>(
+          begin, begin, n, f, detail::ScanIdentity{}, Value()));
 }
 
 /*!
@@ -90,27 +154,15 @@ concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive_inplace(
     ValueT v)
 {
   using Value = typename ::std::iterator_traits<Iter>::value_type;
-  const int n = end - begin;
-  const int p0 = std::min(n, omp_get_max_threads());
-  ::std::vector<Value> sums(p0, v);
-#pragma omp parallel num_threads(p0)
-  {
-    const int p = omp_get_num_threads();
-    const int pid = omp_get_thread_num();
-    const int i0 = firstIndex(n, p, pid);
-    const int i1 = firstIndex(n, p, pid + 1);
-    const Value init = ((pid == 0) ? v : *(begin + i0 - 1));
-#pragma omp barrier
-    exclusive_inplace(loop_exec{}, begin + i0, begin + i1, f, init);
-    sums[pid] = *(begin + i1 - 1);
-#pragma omp barrier
-#pragma omp single
-    exclusive_inplace(
-        loop_exec{}, sums.data(), sums.data() + p, f, BinFn::identity());
-    for (int i = i0; i < i1; ++i) {
-      *(begin + i) = f(*(begin + i), sums[pid]);
-    }
-  }
+  const Index_type n = end - begin;
+  detail::ompBlockScan(
+      n,
+      detail::makeBlockScan<false>(begin,
+                                   begin,
+                                   n,
+                                   f,
+                                   detail::ScanIdentity{},
+                                   static_cast<Value>(v)));
 }
 
 /*!
@@ -125,8 +177,7 @@ concepts::enable_if<type_traits::is_openmp_policy<Policy>> inclusive(
     OutIter out,
     BinFn f)
 {
-  ::std::copy(begin, end, out);
-  inclusive_inplace(exec, out, out + (end - begin), f);
+  transform_inclusive(exec, begin, end, out, f, detail::ScanIdentity{});
 }
 
 /*!
@@ -146,8 +197,83 @@ concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive(
     BinFn f,
     ValueT v)
 {
-  ::std::copy(begin, end, out);
-  exclusive_inplace(exec, out, out + (end - begin), f, v);
+  transform_exclusive(exec, begin, end, out, f, detail::ScanIdentity{}, v);
+}
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   segment head predicate; the scan restarts at every index i with head(i)
+*/
+template <typename Policy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename HeadFn>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> inclusive_segmented(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f,
+    HeadFn head)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  const Index_type n = end - begin;
+  detail::ompBlockScan(
+      n,
+      detail::makeSegmentedBlockScan<true>(begin, out, n, f, head, Value()));
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function,
+   segment head predicate, and initial value of every segment
+*/
+template <typename Policy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename HeadFn,
+          typename ValueT>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive_segmented(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f,
+    HeadFn head,
+    ValueT v)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  const Index_type n = end - begin;
+  detail::ompBlockScan(n,
+                      detail::makeSegmentedBlockScan<false>(
+                          begin, out, n, f, head, static_cast<Value>(v)));
+}
+
+/*!
+        \brief stable compaction of the range of n elements at begin: element
+   i goes in order to out_true if sel(i) and to out_false otherwise; returns
+   the number of elements written to out_true
+*/
+template <typename Policy,
+          typename Iter,
+          typename OutTrue,
+          typename OutFalse,
+          typename SelectFn>
+typename std::enable_if<type_traits::is_openmp_policy<Policy>::value,
+                        Index_type>::type
+compact(const Policy&,
+        Iter begin,
+        Index_type n,
+        OutTrue out_true,
+        OutFalse out_false,
+        SelectFn sel)
+{
+  Index_type count = 0;
+  detail::ompBlockScan(
+      n,
+      detail::makeCompactBlocks(begin, out_true, out_false, n, sel, &count));
+  return count;
 }
 
 }  // namespace scan
@@ -0,0 +1,135 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_openmp_HPP
+#define RAJA_sort_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#include <omp.h>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/detail/sort.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+namespace detail
+{
+
+//! for_blocks that runs the blocks in an OpenMP parallel loop
+struct OmpForBlocks {
+  template <typename Body>
+  void operator()(Index_type m, Body body) const
+  {
+#pragma omp parallel for schedule(static)
+    for (Index_type i = 0; i < m; ++i) {
+      body(i);
+    }
+  }
+};
+
+}  // namespace detail
+
+/*!
+        \brief sort given range and comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>> unstable(
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  detail::sortEngine<false>(
+      detail::OmpForBlocks{}, omp_get_max_threads(), begin, end, comp);
+}
+
+/*!
+        \brief stable sort given range and comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>> stable(
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  detail::sortEngine<true>(
+      detail::OmpForBlocks{}, omp_get_max_threads(), begin, end, comp);
+}
+
+/*!
+        \brief sort given key range, value range, and comparison function
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>> unstable_pairs(
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  detail::sortPairsEngine<false>(detail::OmpForBlocks{},
+                                 omp_get_max_threads(),
+                                 keys_begin,
+                                 keys_end,
+                                 vals_begin,
+                                 comp);
+}
+
+/*!
+        \brief stable sort given key range, value range, and comparison
+   function
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>> stable_pairs(
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  detail::sortPairsEngine<true>(detail::OmpForBlocks{},
+                                omp_get_max_threads(),
+                                keys_begin,
+                                keys_end,
+                                vals_begin,
+                                comp);
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
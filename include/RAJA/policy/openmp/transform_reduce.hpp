@@ -0,0 +1,141 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA transform-reduce declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_transform_reduce_openmp_HPP
+#define RAJA_transform_reduce_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#include <omp.h>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/detail/transform_reduce.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace transform_reduce
+{
+
+namespace detail
+{
+
+//! OpenMP reduction clause for operators::plus
+template <typename T, typename Fn>
+T ompNativeReduce(Index_type n, T init, operators::plus<T>, Fn f)
+{
+  T acc = init;
+#pragma omp parallel for reduction(+ : acc)
+  for (Index_type i = 0; i < n; ++i) {
+    acc += f(i);
+  }
+  return acc;
+}
+
+//! OpenMP reduction clause for operators::multiplies
+template <typename T, typename Fn>
+T ompNativeReduce(Index_type n, T init, operators::multiplies<T>, Fn f)
+{
+  T acc = init;
+#pragma omp parallel for reduction(* : acc)
+  for (Index_type i = 0; i < n; ++i) {
+    acc *= f(i);
+  }
+  return acc;
+}
+
+//! OpenMP reduction clause for operators::minimum
+template <typename T, typename Fn>
+T ompNativeReduce(Index_type n, T init, operators::minimum<T>, Fn f)
+{
+  T acc = init;
+#pragma omp parallel for reduction(min : acc)
+  for (Index_type i = 0; i < n; ++i) {
+    const T v = f(i);
+    acc = v < acc ? v : acc;
+  }
+  return acc;
+}
+
+//! OpenMP reduction clause for operators::maximum
+template <typename T, typename Fn>
+T ompNativeReduce(Index_type n, T init, operators::maximum<T>, Fn f)
+{
+  T acc = init;
+#pragma omp parallel for reduction(max : acc)
+  for (Index_type i = 0; i < n; ++i) {
+    const T v = f(i);
+    acc = v > acc ? v : acc;
+  }
+  return acc;
+}
+
+template <typename T, typename BinFn, typename Fn>
+T ompReduce(Index_type n, T init, BinFn op, Fn f, std::true_type)
+{
+  return ompNativeReduce(n, init, op, f);
+}
+
+//! Any other op: one partial per thread, folded in thread order
+template <typename T, typename BinFn, typename Fn>
+T ompReduce(Index_type n, T init, BinFn op, Fn f, std::false_type)
+{
+  const Index_type p0 =
+      std::min(n, static_cast<Index_type>(omp_get_max_threads()));
+  std::vector<BlockPartial<T>> partials(p0);
+#pragma omp parallel num_threads(p0)
+  {
+    const Index_type p = omp_get_num_threads();
+    const Index_type pid = omp_get_thread_num();
+    reduceBlock(n, p, pid, op, f, partials[pid]);
+  }
+  return combinePartials(init, op, partials.data(), p0);
+}
+
+}  // namespace detail
+
+/*!
+        \brief reduce f(i) over i in [0, n) with op, starting from init
+*/
+template <typename ExecPolicy, typename T, typename BinFn, typename Fn>
+typename std::enable_if<
+    type_traits::is_openmp_policy<ExecPolicy>::value, T>::type
+reduce(const ExecPolicy&, Index_type n, T init, BinFn op, Fn f)
+{
+  if (n <= 0) {
+    return init;
+  }
+  return detail::ompReduce(
+      n, init, op, f, detail::is_native_reduction<T, BinFn>{});
+}
+
+}  // namespace transform_reduce
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
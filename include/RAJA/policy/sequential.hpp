@@ -26,6 +26,9 @@
 #include "RAJA/policy/sequential/policy.hpp"
 #include "RAJA/policy/sequential/reduce.hpp"
 #include "RAJA/policy/sequential/scan.hpp"
+#include "RAJA/policy/sequential/sort.hpp"
+#include "RAJA/policy/sequential/histogram.hpp"
+#include "RAJA/policy/sequential/transform_reduce.hpp"
 
 
 #endif  // closing endif for header file include guard
@@ -68,11 +68,20 @@ struct seq_reduce : make_policy_pattern_launch_platform_t<Policy::sequential,
                                                           Launch::undefined,
                                                           Platform::host> {
 };
+
+struct seq_reduce_reproducible
+    : make_policy_pattern_launch_platform_t<Policy::sequential,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            reduce::reproducible> {
+};
 }  // namespace sequential
 }  // namespace policy
 
 using policy::sequential::seq_exec;
 using policy::sequential::seq_reduce;
+using policy::sequential::seq_reduce_reproducible;
 using policy::sequential::seq_region;
 using policy::sequential::seq_segit;
 
@@ -26,6 +26,7 @@
 #include "RAJA/internal/MemUtils_CPU.hpp"
 
 #include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/detail/reduce_reproducible.hpp"
 #include "RAJA/pattern/reduce.hpp"
 
 #include "RAJA/policy/sequential/policy.hpp"
@@ -50,10 +51,29 @@ public:
   using Base::Base;
 };
 
+template <typename T, typename Reduce>
+class ReduceSeqReproducible
+    : public reduce::detail::
+          BaseReproducible<T, Reduce, ReduceSeqReproducible<T, Reduce>>
+{
+  using Base = reduce::detail::
+      BaseReproducible<T, Reduce, ReduceSeqReproducible<T, Reduce>>;
+
+public:
+  //! prohibit compiler-generated default ctor
+  ReduceSeqReproducible() = delete;
+
+  using Base::Base;
+};
+
 
 }  // namespace detail
 
 RAJA_DECLARE_ALL_REDUCERS(seq_reduce, detail::ReduceSeq)
+RAJA_DECLARE_ARRAY_REDUCER(seq_reduce, detail::ReduceSeq)
+RAJA_DECLARE_GENERIC_REDUCER(seq_reduce, detail::ReduceSeq)
+RAJA_DECLARE_ALL_REDUCERS(seq_reduce_reproducible,
+                          detail::ReduceSeqReproducible)
 
 }  // namespace RAJA
 
@@ -23,10 +23,14 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <type_traits>
 
 #include "RAJA/util/macros.hpp"
 
 #include "RAJA/util/concepts.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/detail/scan.hpp"
 
 #include "RAJA/policy/sequential/policy.hpp"
 
@@ -61,11 +65,11 @@ template <typename ExecPolicy, typename Iter, typename BinFn, typename T>
 concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
 exclusive_inplace(const ExecPolicy &, Iter begin, Iter end, BinFn f, T v)
 {
-  const int n = end - begin;
+  const Index_type n = end - begin;
   decltype(*begin) agg = v;
 
   RAJA_NO_SIMD
-  for (int i = 0; i < n; ++i) {
+  for (Index_type i = 0; i < n; ++i) {
     auto t = *(begin + i);
     *(begin + i) = agg;
     agg = f(agg, t);
@@ -122,6 +126,159 @@ concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>> exclusive(
   }
 }
 
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   unary operation applied to each input element
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename UnaryFn>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>> transform_inclusive(
+    const ExecPolicy &,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f,
+    UnaryFn op)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  Value agg = op(*begin);
+  *out++ = agg;
+
+  RAJA_NO_SIMD
+  for (Iter i = begin + 1; i != end; ++i) {
+    agg = f(agg, op(*i));
+    *out++ = agg;
+  }
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function,
+   unary operation applied to each input element, and initial value
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename UnaryFn,
+          typename T>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>> transform_exclusive(
+    const ExecPolicy &,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f,
+    UnaryFn op,
+    T v)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  Value agg = v;
+
+  RAJA_NO_SIMD
+  for (Iter i = begin; i != end; ++i) {
+    const Value t = op(*i);
+    *out++ = agg;
+    agg = f(agg, t);
+  }
+}
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   segment head predicate; the scan restarts at every index i with head(i)
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename HeadFn>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>> inclusive_segmented(
+    const ExecPolicy &,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f,
+    HeadFn head)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  const Index_type n = end - begin;
+  Value agg = *begin;
+  *out = agg;
+
+  RAJA_NO_SIMD
+  for (Index_type i = 1; i < n; ++i) {
+    agg = head(i) ? Value(*(begin + i)) : f(agg, *(begin + i));
+    *(out + i) = agg;
+  }
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function,
+   segment head predicate, and initial value of every segment
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename HeadFn,
+          typename T>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>> exclusive_segmented(
+    const ExecPolicy &,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f,
+    HeadFn head,
+    T v)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  const Index_type n = end - begin;
+  Value agg = v;
+
+  RAJA_NO_SIMD
+  for (Index_type i = 0; i < n; ++i) {
+    if (head(i)) {
+      agg = v;
+    }
+    const Value t = *(begin + i);
+    *(out + i) = agg;
+    agg = f(agg, t);
+  }
+}
+
+/*!
+        \brief stable compaction of the range of n elements at begin: element
+   i goes in order to out_true if sel(i) and to out_false otherwise; returns
+   the number of elements written to out_true
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutTrue,
+          typename OutFalse,
+          typename SelectFn>
+typename std::enable_if<type_traits::is_sequential_policy<ExecPolicy>::value,
+                        Index_type>::type
+compact(const ExecPolicy &,
+        const Iter begin,
+        Index_type n,
+        OutTrue out_true,
+        OutFalse out_false,
+        SelectFn sel)
+{
+  Index_type k = 0;
+
+  RAJA_NO_SIMD
+  for (Index_type i = 0; i < n; ++i) {
+    if (sel(i)) {
+      detail::compactStore(out_true, k++, *(begin + i));
+    } else {
+      detail::compactStore(out_false, i - k, *(begin + i));
+    }
+  }
+  return k;
+}
+
 }  // namespace scan
 
 }  // namespace impl
@@ -0,0 +1,61 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA transform-reduce declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_transform_reduce_sequential_HPP
+#define RAJA_transform_reduce_sequential_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/detail/transform_reduce.hpp"
+
+#include "RAJA/policy/sequential/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace transform_reduce
+{
+
+/*!
+        \brief reduce f(i) over i in [0, n) with op, starting from init
+*/
+template <typename ExecPolicy, typename T, typename BinFn, typename Fn>
+typename std::enable_if<
+    type_traits::is_sequential_policy<ExecPolicy>::value, T>::type
+reduce(const ExecPolicy&, Index_type n, T init, BinFn op, Fn f)
+{
+  T acc = init;
+  RAJA_NO_SIMD
+  for (Index_type i = 0; i < n; ++i) {
+    acc = op(acc, f(i));
+  }
+  return acc;
+}
+
+}  // namespace transform_reduce
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
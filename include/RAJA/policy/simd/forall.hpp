@@ -31,10 +31,16 @@
 #include <iterator>
 #include <type_traits>
 
+#include "RAJA/util/VectorRegister.hpp"
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/index/IndexValue.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
 #include "RAJA/internal/fault_tolerance.hpp"
 
+#include "RAJA/pattern/detail/forall_param.hpp"
+
 #include "RAJA/policy/simd/policy.hpp"
 
 namespace RAJA
@@ -59,6 +65,77 @@ RAJA_INLINE void forall_impl(const simd_exec &,
   }
 }
 
+//! The whole range is one chunk; the body vectorizes its own loop
+template <typename Segment, typename Func>
+RAJA_INLINE void forall_chunked_impl(const simd_exec &,
+                                     Segment &&seg,
+                                     Func &&body)
+{
+  body(seg);
+}
+
+/*!
+ * \brief One set of accumulators for the whole loop.  Every iteration
+ *        updates them, so the loop is left to the compiler to vectorize
+ *        rather than marked RAJA_SIMD.
+ */
+template <typename Iterable, typename Func, typename... Params>
+RAJA_INLINE void forall_param_impl(
+    const simd_exec &,
+    Iterable &&iter,
+    RAJA::detail::ForallParamPack<Params...> const &params,
+    Func &&loop_body)
+{
+  auto begin = std::begin(iter);
+  auto end = std::end(iter);
+  auto distance = std::distance(begin, end);
+  auto values = params.identities();
+  auto body = RAJA::detail::makeForallParamBody(loop_body, values);
+  for (decltype(distance) i = 0; i < distance; ++i) {
+    body(*(begin + i));
+  }
+  params.finalize(values);
+}
+
+namespace detail
+{
+
+template <typename Iterable>
+struct is_range_segment : std::false_type {
+};
+
+template <typename StorageT, typename DiffT>
+struct is_range_segment<TypedRangeSegment<StorageT, DiffT>> : std::true_type {
+};
+
+}  // namespace detail
+
+template <typename Iterable, typename Func, size_t Width>
+RAJA_INLINE void forall_impl(const vector_exec<Width> &,
+                             Iterable &&iter,
+                             Func &&loop_body)
+{
+  using segment_type = typename std::decay<Iterable>::type;
+  static_assert(detail::is_range_segment<segment_type>::value,
+                "vector_exec can only execute range segments");
+  using index_type = strip_index_type_t<typename segment_type::value_type>;
+  using pack_type = VectorIndex<index_type, Width>;
+
+  auto begin = std::begin(iter);
+  auto end = std::end(iter);
+  auto distance = std::distance(begin, end);
+  const index_type first = stripIndexType(*begin);
+  const auto full = distance - distance % static_cast<decltype(distance)>(Width);
+
+  for (decltype(distance) i = 0; i < full; i += Width) {
+    loop_body(pack_type(static_cast<index_type>(first + i)));
+  }
+  if (full < distance) {
+    loop_body(pack_type(static_cast<index_type>(first + full),
+                        static_cast<size_t>(distance - full)));
+  }
+}
+
 }  // namespace simd
 
 }  // namespace policy
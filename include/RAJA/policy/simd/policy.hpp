@@ -18,6 +18,8 @@
 #ifndef policy_simd_HPP
 #define policy_simd_HPP
 
+#include <cstddef>
+
 #include "RAJA/policy/PolicyBase.hpp"
 
 //
@@ -44,11 +46,24 @@ struct simd_exec : make_policy_pattern_launch_platform_t<Policy::sequential,
                                                          Platform::host> {
 };
 
+///
+/// The loop body receives VectorIndex<IdxT, Width> packs of Width
+/// consecutive indices instead of single indices; the last pack of a loop
+/// may be partial.  Only range segments can be executed this way.
+///
+template <size_t Width>
+struct vector_exec : make_policy_pattern_launch_platform_t<Policy::simd,
+                                                           Pattern::forall,
+                                                           Launch::undefined,
+                                                           Platform::host> {
+};
+
 }  // end of namespace simd
 
 }  // end of namespace policy
 
 using policy::simd::simd_exec;
+using policy::simd::vector_exec;
 
 }  // end of namespace RAJA
 
@@ -26,6 +26,9 @@
 #include "RAJA/policy/tbb/policy.hpp"
 #include "RAJA/policy/tbb/reduce.hpp"
 #include "RAJA/policy/tbb/scan.hpp"
+#include "RAJA/policy/tbb/sort.hpp"
+#include "RAJA/policy/tbb/histogram.hpp"
+#include "RAJA/policy/tbb/transform_reduce.hpp"
 
 #endif
 
@@ -31,6 +31,7 @@
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 #include "RAJA/internal/fault_tolerance.hpp"
+#include "RAJA/pattern/detail/forall_param.hpp"
 #include "RAJA/pattern/forall.hpp"
 #include "RAJA/policy/tbb/policy.hpp"
 #include "RAJA/util/types.hpp"
@@ -130,6 +131,154 @@ RAJA_INLINE void forall_impl(const tbb_for_static<ChunkSize>&,
       tbb_static_partitioner{});
 }
 
+///
+/// TBB chunked implementations; see RAJA::forall_chunked
+///
+
+/**
+ * @brief TBB dynamic chunked implementation
+ *
+ * Each blocked_range the scheduler hands to a thread, of at most the grain
+ * size of the policy, is passed to the body as one sub-range.
+ */
+template <typename Segment, typename Func>
+RAJA_INLINE void forall_chunked_impl(const tbb_for_dynamic& p,
+                                     Segment&& seg,
+                                     Func&& loop_body)
+{
+  using diff_type = typename camp::decay<Segment>::IndexType;
+  using brange = ::tbb::blocked_range<diff_type>;
+  auto s = camp::decay<Segment>(seg);
+  ::tbb::parallel_for(brange(0, s.size(), p.grain_size),
+                      [=](const brange& r) {
+                        using RAJA::internal::thread_privatize;
+                        auto privatizer = thread_privatize(loop_body);
+                        auto body = privatizer.get_priv();
+                        body(RAJA::detail::range_chunk(s, r.begin(), r.end()));
+                      });
+}
+
+/**
+ * @brief TBB static chunked implementation
+ *
+ * As the dynamic version, with the static partitioner and ChunkSize as the
+ * grain size.
+ */
+template <typename Segment, typename Func, size_t ChunkSize>
+RAJA_INLINE void forall_chunked_impl(const tbb_for_static<ChunkSize>&,
+                                     Segment&& seg,
+                                     Func&& loop_body)
+{
+  using diff_type = typename camp::decay<Segment>::IndexType;
+  using brange = ::tbb::blocked_range<diff_type>;
+  auto s = camp::decay<Segment>(seg);
+  ::tbb::parallel_for(
+      brange(0, s.size(), ChunkSize),
+      [=](const brange& r) {
+        using RAJA::internal::thread_privatize;
+        auto privatizer = thread_privatize(loop_body);
+        auto body = privatizer.get_priv();
+        body(RAJA::detail::range_chunk(s, r.begin(), r.end()));
+      },
+      tbb_static_partitioner{});
+}
+
+///
+/// TBB implementations with reduction parameters; see RAJA::forall_param
+///
+
+namespace detail
+{
+
+/*!
+ * \brief parallel_reduce body for forall_param; a split body starts from
+ *        new accumulators, which join folds back in range order
+ */
+template <typename Iter, typename Func, typename Pack>
+struct ParamReduceBody {
+  Iter begin_it;
+  Func const& loop_body;
+  Pack const& params;
+  typename Pack::values_type values;
+
+  ParamReduceBody(Iter begin_it_, Func const& loop_body_, Pack const& params_)
+      : begin_it(begin_it_),
+        loop_body(loop_body_),
+        params(params_),
+        values(params_.identities())
+  {
+  }
+
+  ParamReduceBody(ParamReduceBody& b, ::tbb::split)
+      : ParamReduceBody(b.begin_it, b.loop_body, b.params)
+  {
+  }
+
+  void operator()(const ::tbb::blocked_range<size_t>& r)
+  {
+    auto body = RAJA::detail::makeForallParamBody(loop_body, values);
+    for (auto i = r.begin(); i != r.end(); ++i)
+      body(begin_it[i]);
+  }
+
+  void join(const ParamReduceBody& rhs) { params.combine(values, rhs.values); }
+};
+
+template <typename Iterable,
+          typename Func,
+          typename Pack,
+          typename... Partitioner>
+RAJA_INLINE void forall_param_reduce(Iterable&& iter,
+                                     Func const& loop_body,
+                                     Pack const& params,
+                                     size_t grain_size,
+                                     Partitioner&&... partitioner)
+{
+  using std::begin;
+  using std::distance;
+  using std::end;
+  using brange = ::tbb::blocked_range<size_t>;
+  auto b = begin(iter);
+  size_t dist = std::abs(distance(begin(iter), end(iter)));
+  ParamReduceBody<decltype(b), Func, Pack> body(b, loop_body, params);
+  ::tbb::parallel_reduce(brange(0, dist, grain_size), body, partitioner...);
+  params.finalize(body.values);
+}
+
+}  // namespace detail
+
+/**
+ * @brief TBB dynamic forall_param implementation
+ *
+ * Accumulators are combined by tbb::parallel_reduce; the body is not copied.
+ */
+template <typename Iterable, typename Func, typename... Params>
+RAJA_INLINE void forall_param_impl(
+    const tbb_for_dynamic& p,
+    Iterable&& iter,
+    RAJA::detail::ForallParamPack<Params...> const& params,
+    Func&& loop_body)
+{
+  detail::forall_param_reduce(iter, loop_body, params, p.grain_size);
+}
+
+/**
+ * @brief TBB static forall_param implementation
+ */
+template <typename Iterable,
+          typename Func,
+          size_t ChunkSize,
+          typename... Params>
+RAJA_INLINE void forall_param_impl(
+    const tbb_for_static<ChunkSize>&,
+    Iterable&& iter,
+    RAJA::detail::ForallParamPack<Params...> const& params,
+    Func&& loop_body)
+{
+  detail::forall_param_reduce(
+      iter, loop_body, params, ChunkSize, tbb_static_partitioner{});
+}
+
 }  // namespace tbb
 }  // namespace policy
 
@@ -79,6 +79,14 @@ struct tbb_reduce : make_policy_pattern_launch_platform_t<Policy::tbb,
                                                           Platform::host> {
 };
 
+struct tbb_reduce_reproducible
+    : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                            Pattern::reduce,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            reduce::reproducible> {
+};
+
 }  // namespace tbb
 }  // namespace policy
 
@@ -86,6 +94,7 @@ using policy::tbb::tbb_for_dynamic;
 using policy::tbb::tbb_for_exec;
 using policy::tbb::tbb_for_static;
 using policy::tbb::tbb_reduce;
+using policy::tbb::tbb_reduce_reproducible;
 using policy::tbb::tbb_segit;
 
 }  // namespace RAJA
@@ -33,6 +33,7 @@
 #include "RAJA/internal/MemUtils_CPU.hpp"
 
 #include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/detail/reduce_reproducible.hpp"
 #include "RAJA/pattern/reduce.hpp"
 
 #include "RAJA/policy/tbb/policy.hpp"
@@ -82,9 +83,68 @@ public:
    */
   T& local() { return data->local(); }
 };
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  TBB reproducible reducer combiner.
+ *
+ *         Keeps one reduce::detail::ReproducibleValue per thread; these
+ *         merge to the same result in any order, however TBB splits the
+ *         range.
+ *
+ ******************************************************************************
+ */
+template <typename T, typename Reduce>
+class ReduceTBBReproducible
+{
+  using Accumulator = reduce::detail::ReproducibleValue<T, Reduce>;
+
+  //! TBB native per-thread container
+  std::shared_ptr<tbb::combinable<Accumulator>> data;
+  T identity;
+
+public:
+  //! default constructor calls the reset method
+  ReduceTBBReproducible() { reset(T(), T()); }
+
+  //! constructor requires a default value for the reducer
+  explicit ReduceTBBReproducible(T init_val, T initializer)
+  {
+    reset(init_val, initializer);
+  }
+
+  void reset(T init_val, T initializer)
+  {
+    identity = initializer;
+    data = std::shared_ptr<tbb::combinable<Accumulator>>(
+        std::make_shared<tbb::combinable<Accumulator>>(
+            [=]() { return Accumulator(initializer); }));
+    data->local() = Accumulator(init_val);
+  }
+
+  /*!
+   *  \return the calculated reduced value
+   */
+  T get() const
+  {
+    Accumulator result(identity);
+    data->combine_each([&](Accumulator const& acc) { result.merge(acc); });
+    return result.get();
+  }
+
+  /*!
+   *  \return update the local value
+   */
+  void combine(const T& other) { data->local().add(other); }
+};
 }  // namespace detail
 
 RAJA_DECLARE_ALL_REDUCERS(tbb_reduce, detail::ReduceTBB)
+RAJA_DECLARE_ARRAY_REDUCER(tbb_reduce, detail::ReduceTBB)
+RAJA_DECLARE_GENERIC_REDUCER(tbb_reduce, detail::ReduceTBB)
+RAJA_DECLARE_ALL_REDUCERS(tbb_reduce_reproducible,
+                          detail::ReduceTBBReproducible)
 
 }  // namespace RAJA
 
@@ -23,11 +23,15 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <type_traits>
 
 #include <tbb/tbb.h>
 
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/detail/scan.hpp"
 
 #include "RAJA/policy/sequential/policy.hpp"
 
@@ -98,6 +102,184 @@ struct scan_adapter_exclusive : scan_adapter<T, InIter, OutIter, Fn> {
     }
   }
 };
+
+/*!
+ * \brief parallel_scan body of a scan of op applied to each input element:
+ *        agg is the combined value of the range seen so far, and exclusive
+ *        outputs prefix it with init
+ */
+template <bool Inclusive,
+          typename T,
+          typename InIter,
+          typename OutIter,
+          typename Fn,
+          typename UnaryFn>
+struct transform_scan_adapter {
+  T agg;
+  InIter const& in;
+  OutIter out;
+  Fn fn;
+  UnaryFn op;
+  T const init;
+
+  transform_scan_adapter(InIter const& in_,
+                         OutIter out_,
+                         Fn fn_,
+                         UnaryFn op_,
+                         T const& init_)
+      : agg(Fn::identity()), in(in_), out(out_), fn(fn_), op(op_), init(init_)
+  {
+  }
+
+  transform_scan_adapter(transform_scan_adapter& b, tbb::split)
+      : agg(Fn::identity()),
+        in(b.in),
+        out(b.out),
+        fn(b.fn),
+        op(b.op),
+        init(b.init)
+  {
+  }
+
+  template <typename Tag>
+  void operator()(const tbb::blocked_range<Index_type>& r, Tag)
+  {
+    T temp = agg;
+    for (Index_type i = r.begin(); i < r.end(); ++i) {
+      if (!Inclusive && Tag::is_final_scan()) out[i] = fn(init, temp);
+      temp = fn(temp, op(in[i]));
+      if (Inclusive && Tag::is_final_scan()) out[i] = temp;
+    }
+    agg = temp;
+  }
+
+  void reverse_join(const transform_scan_adapter& a) { agg = fn(a.agg, agg); }
+  void assign(const transform_scan_adapter& b) { agg = b.agg; }
+};
+
+/*!
+ * \brief parallel_scan body of a segmented scan: agg is the running total of
+ *        the open segment and head records whether a segment started in the
+ *        range seen so far, so a join stops the carry at that head
+ */
+template <bool Inclusive,
+          typename T,
+          typename InIter,
+          typename OutIter,
+          typename Fn,
+          typename HeadFn>
+struct segmented_scan_adapter {
+  T agg;
+  bool head;
+  InIter const& in;
+  OutIter out;
+  Fn fn;
+  HeadFn is_head;
+  T const init;
+
+  segmented_scan_adapter(InIter const& in_,
+                         OutIter out_,
+                         Fn fn_,
+                         HeadFn is_head_,
+                         T const& init_)
+      : agg(Fn::identity()),
+        head(false),
+        in(in_),
+        out(out_),
+        fn(fn_),
+        is_head(is_head_),
+        init(init_)
+  {
+  }
+
+  segmented_scan_adapter(segmented_scan_adapter& b, tbb::split)
+      : agg(Fn::identity()),
+        head(false),
+        in(b.in),
+        out(b.out),
+        fn(b.fn),
+        is_head(b.is_head),
+        init(b.init)
+  {
+  }
+
+  template <typename Tag>
+  void operator()(const tbb::blocked_range<Index_type>& r, Tag)
+  {
+    T temp = agg;
+    for (Index_type i = r.begin(); i < r.end(); ++i) {
+      const bool h = is_head(i);
+      if (!Inclusive && Tag::is_final_scan()) {
+        out[i] = h ? init : fn(init, temp);
+      }
+      temp = h ? T(in[i]) : fn(temp, in[i]);
+      head = head || h;
+      if (Inclusive && Tag::is_final_scan()) out[i] = temp;
+    }
+    agg = temp;
+  }
+
+  void reverse_join(const segmented_scan_adapter& a)
+  {
+    if (!head) agg = fn(a.agg, agg);
+    head = head || a.head;
+  }
+
+  void assign(const segmented_scan_adapter& b)
+  {
+    agg = b.agg;
+    head = b.head;
+  }
+};
+
+/*!
+ * \brief parallel_scan body of a stable compaction: kept counts the
+ *        elements selected in the range seen so far
+ */
+template <typename InIter, typename OutTrue, typename OutFalse, typename SelectFn>
+struct compact_adapter {
+  Index_type kept;
+  InIter const& in;
+  OutTrue out_true;
+  OutFalse out_false;
+  SelectFn sel;
+
+  compact_adapter(InIter const& in_,
+                  OutTrue out_true_,
+                  OutFalse out_false_,
+                  SelectFn sel_)
+      : kept(0), in(in_), out_true(out_true_), out_false(out_false_), sel(sel_)
+  {
+  }
+
+  compact_adapter(compact_adapter& b, tbb::split)
+      : kept(0),
+        in(b.in),
+        out_true(b.out_true),
+        out_false(b.out_false),
+        sel(b.sel)
+  {
+  }
+
+  template <typename Tag>
+  void operator()(const tbb::blocked_range<Index_type>& r, Tag)
+  {
+    Index_type k = kept;
+    for (Index_type i = r.begin(); i < r.end(); ++i) {
+      if (sel(i)) {
+        if (Tag::is_final_scan()) compactStore(out_true, k, *(in + i));
+        ++k;
+      } else if (Tag::is_final_scan()) {
+        compactStore(out_false, i - k, *(in + i));
+      }
+    }
+    kept = k;
+  }
+
+  void reverse_join(const compact_adapter& a) { kept += a.kept; }
+  void assign(const compact_adapter& b) { kept = b.kept; }
+};
+
 }  // namespace detail
 
 /*!
@@ -192,6 +374,140 @@ concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> exclusive(
                      adapter);
 }
 
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   unary operation applied to each input element
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename UnaryFn>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> transform_inclusive(
+    const ExecPolicy&,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f,
+    UnaryFn op)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  using Adapter = detail::
+      transform_scan_adapter<true, Value, Iter, OutIter, BinFn, UnaryFn>;
+  auto adapter = Adapter{begin, out, f, op, BinFn::identity()};
+  tbb::parallel_scan(tbb::blocked_range<Index_type>{0,
+                                                    std::distance(begin, end)},
+                     adapter);
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function,
+   unary operation applied to each input element, and initial value
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename UnaryFn,
+          typename T>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> transform_exclusive(
+    const ExecPolicy&,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f,
+    UnaryFn op,
+    T v)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  using Adapter = detail::
+      transform_scan_adapter<false, Value, Iter, OutIter, BinFn, UnaryFn>;
+  auto adapter = Adapter{begin, out, f, op, static_cast<Value>(v)};
+  tbb::parallel_scan(tbb::blocked_range<Index_type>{0,
+                                                    std::distance(begin, end)},
+                     adapter);
+}
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   segment head predicate; the scan restarts at every index i with head(i)
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename HeadFn>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> inclusive_segmented(
+    const ExecPolicy&,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f,
+    HeadFn head)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  auto adapter =
+      detail::segmented_scan_adapter<true, Value, Iter, OutIter, BinFn, HeadFn>{
+          begin, out, f, head, BinFn::identity()};
+  tbb::parallel_scan(tbb::blocked_range<Index_type>{0,
+                                                    std::distance(begin, end)},
+                     adapter);
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function,
+   segment head predicate, and initial value of every segment
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename HeadFn,
+          typename T>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> exclusive_segmented(
+    const ExecPolicy&,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f,
+    HeadFn head,
+    T v)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  auto adapter =
+      detail::segmented_scan_adapter<false, Value, Iter, OutIter, BinFn, HeadFn>{
+          begin, out, f, head, static_cast<Value>(v)};
+  tbb::parallel_scan(tbb::blocked_range<Index_type>{0,
+                                                    std::distance(begin, end)},
+                     adapter);
+}
+
+/*!
+        \brief stable compaction of the range of n elements at begin: element
+   i goes in order to out_true if sel(i) and to out_false otherwise; returns
+   the number of elements written to out_true
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutTrue,
+          typename OutFalse,
+          typename SelectFn>
+typename std::enable_if<type_traits::is_tbb_policy<ExecPolicy>::value,
+                        Index_type>::type
+compact(const ExecPolicy&,
+        const Iter begin,
+        Index_type n,
+        OutTrue out_true,
+        OutFalse out_false,
+        SelectFn sel)
+{
+  auto adapter =
+      detail::compact_adapter<Iter, OutTrue, OutFalse, SelectFn>{
+          begin, out_true, out_false, sel};
+  tbb::parallel_scan(tbb::blocked_range<Index_type>{0, n}, adapter);
+  return adapter.kept;
+}
+
 }  // namespace scan
 
 }  // namespace impl
@@ -0,0 +1,138 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_tbb_HPP
+#define RAJA_sort_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#include <tbb/tbb.h>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/detail/sort.hpp"
+
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+namespace detail
+{
+
+//! for_blocks that runs the blocks in a TBB parallel loop
+struct TbbForBlocks {
+  template <typename Body>
+  void operator()(Index_type m, Body body) const
+  {
+    tbb::parallel_for(Index_type(0), m, body);
+  }
+};
+
+}  // namespace detail
+
+/*!
+        \brief sort given range and comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> unstable(
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  detail::sortEngine<false>(detail::TbbForBlocks{},
+                            tbb::this_task_arena::max_concurrency(),
+                            begin,
+                            end,
+                            comp);
+}
+
+/*!
+        \brief stable sort given range and comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> stable(
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  detail::sortEngine<true>(detail::TbbForBlocks{},
+                           tbb::this_task_arena::max_concurrency(),
+                           begin,
+                           end,
+                           comp);
+}
+
+/*!
+        \brief sort given key range, value range, and comparison function
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> unstable_pairs(
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  detail::sortPairsEngine<false>(detail::TbbForBlocks{},
+                                 tbb::this_task_arena::max_concurrency(),
+                                 keys_begin,
+                                 keys_end,
+                                 vals_begin,
+                                 comp);
+}
+
+/*!
+        \brief stable sort given key range, value range, and comparison
+   function
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> stable_pairs(
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  detail::sortPairsEngine<true>(detail::TbbForBlocks{},
+                                tbb::this_task_arena::max_concurrency(),
+                                keys_begin,
+                                keys_end,
+                                vals_begin,
+                                comp);
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
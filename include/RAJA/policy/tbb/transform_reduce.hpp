@@ -0,0 +1,107 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA transform-reduce declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_transform_reduce_tbb_HPP
+#define RAJA_transform_reduce_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include <tbb/tbb.h>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/detail/transform_reduce.hpp"
+
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace transform_reduce
+{
+
+namespace detail
+{
+
+/*!
+ * \brief parallel_reduce body; valid is false until the body has seen an
+ *        element, so no identity of op is needed
+ */
+template <typename T, typename BinFn, typename Fn>
+struct reduce_body {
+  T value;
+  bool valid;
+  BinFn op;
+  Fn f;
+
+  reduce_body(BinFn op_, Fn f_) : value(), valid(false), op(op_), f(f_) {}
+
+  reduce_body(reduce_body& b, tbb::split)
+      : value(), valid(false), op(b.op), f(b.f)
+  {
+  }
+
+  void operator()(const tbb::blocked_range<Index_type>& r)
+  {
+    Index_type i = r.begin();
+    if (!valid && i < r.end()) {
+      value = f(i++);
+      valid = true;
+    }
+    for (; i < r.end(); ++i) {
+      value = op(value, f(i));
+    }
+  }
+
+  void join(const reduce_body& rhs)
+  {
+    if (rhs.valid) {
+      value = valid ? op(value, rhs.value) : rhs.value;
+      valid = true;
+    }
+  }
+};
+
+}  // namespace detail
+
+/*!
+        \brief reduce f(i) over i in [0, n) with op, starting from init
+*/
+template <typename ExecPolicy, typename T, typename BinFn, typename Fn>
+typename std::enable_if<
+    type_traits::is_tbb_policy<ExecPolicy>::value, T>::type
+reduce(const ExecPolicy&, Index_type n, T init, BinFn op, Fn f)
+{
+  if (n <= 0) {
+    return init;
+  }
+  detail::reduce_body<T, BinFn, Fn> body(op, f);
+  tbb::parallel_reduce(tbb::blocked_range<Index_type>(0, n), body);
+  return body.valid ? op(init, body.value) : init;
+}
+
+}  // namespace transform_reduce
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
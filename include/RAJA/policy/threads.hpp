@@ -0,0 +1,38 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA headers for std::thread pool
+ *          execution.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_threads_HPP
+#define RAJA_threads_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include "RAJA/policy/threads/ThreadPool.hpp"
+#include "RAJA/policy/threads/atomic.hpp"
+#include "RAJA/policy/threads/forall.hpp"
+#include "RAJA/policy/threads/policy.hpp"
+#include "RAJA/policy/threads/reduce.hpp"
+#include "RAJA/policy/threads/scan.hpp"
+#include "RAJA/policy/threads/sort.hpp"
+#include "RAJA/policy/threads/histogram.hpp"
+#include "RAJA/policy/threads/transform_reduce.hpp"
+
+#endif
+
+#endif  // closing endif for header file include guard
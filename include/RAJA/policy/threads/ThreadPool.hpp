@@ -0,0 +1,355 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining the persistent work-stealing thread pool
+ *          used by the RAJA threads back-end.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_threads_ThreadPool_HPP
+#define RAJA_threads_ThreadPool_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/util/AsyncEvent.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+namespace threads
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Completion counter shared by all tasks spawned for one launch.
+ *
+ *         The counter holds the number of iterations that have not finished
+ *         executing; the launch is complete when it reaches zero.  The first
+ *         exception thrown by a task is kept, the remaining tasks are
+ *         skipped, and the launching thread rethrows it once it is done.
+ *
+ ******************************************************************************
+ */
+class TaskGroup
+{
+public:
+  explicit TaskGroup(Index_type work = 0) : m_remaining(work), m_failed(false)
+  {
+  }
+
+  TaskGroup(const TaskGroup&) = delete;
+  TaskGroup& operator=(const TaskGroup&) = delete;
+
+  void add(Index_type work)
+  {
+    m_remaining.fetch_add(work, std::memory_order_relaxed);
+  }
+
+  void complete(Index_type work)
+  {
+    m_remaining.fetch_sub(work, std::memory_order_acq_rel);
+  }
+
+  bool done() const { return m_remaining.load(std::memory_order_acquire) == 0; }
+
+  //! keep error unless an earlier task has already failed
+  void fail(std::exception_ptr error)
+  {
+    std::lock_guard<std::mutex> lock(m_error_lock);
+    if (!m_error) m_error = error;
+    m_failed.store(true, std::memory_order_release);
+  }
+
+  bool failed() const { return m_failed.load(std::memory_order_acquire); }
+
+  //! rethrow the kept exception, if any; call once done() is true
+  void rethrow() const
+  {
+    if (failed()) std::rethrow_exception(m_error);
+  }
+
+private:
+  std::atomic<Index_type> m_remaining;
+  std::atomic<bool> m_failed;
+  std::mutex m_error_lock;
+  std::exception_ptr m_error;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Type-erased piece of a parallel loop: the half-open iteration
+ *         range [begin, end) of the function stored at data.
+ *
+ *         Pieces longer than grain are split in half by the thread that
+ *         executes them, which keeps the larger halves available for
+ *         stealing.
+ *
+ ******************************************************************************
+ */
+struct Task {
+  using function_type = void (*)(void*, Index_type, Index_type);
+
+  function_type fn;
+  void* data;
+  Index_type begin;
+  Index_type end;
+  Index_type grain;
+  TaskGroup* group;
+};
+
+namespace detail
+{
+
+template <typename Func>
+void invokeRange(void* data, Index_type begin, Index_type end)
+{
+  (*static_cast<Func*>(data))(begin, end);
+}
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Persistent pool of std::threads with per-thread task deques and
+ *         work stealing.
+ *
+ *         Slot 0 belongs to the threads that are not pool workers (the
+ *         application threads launching loops); slots 1..N-1 belong to the
+ *         workers.  A launching thread always takes part in executing its
+ *         own loop, so a pool of N threads runs N-1 workers.
+ *
+ *         Each thread pops work from the back of its own deque and steals
+ *         from the front of the others.  Idle workers spin briefly before
+ *         sleeping on a condition variable, so back-to-back launches find the
+ *         pool warm.
+ *
+ *         The pool size defaults to the RAJA_NUM_THREADS environment
+ *         variable, or to std::thread::hardware_concurrency() when it is not
+ *         set.
+ *
+ ******************************************************************************
+ */
+class ThreadPool
+{
+public:
+  //! Return the process-wide pool, starting it on first use.
+  static ThreadPool& getInstance();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  ~ThreadPool();
+
+  //! Number of threads executing pool work, including the launching thread.
+  int getNumThreads() const { return static_cast<int>(m_queues.size()); }
+
+  //! Slot of the calling thread: 0 for non-pool threads, else the worker id.
+  static int getThreadNum();
+
+  /*!
+   * \brief Restart the pool with num_threads threads.
+   *
+   * Must not be called while loops are executing on the pool.
+   */
+  void resize(int num_threads);
+
+  /*!
+   * \brief Execute body(begin, end) over sub-ranges covering [0, n).
+   *
+   * Blocks until every iteration has completed.  Sub-ranges contain at most
+   * grain iterations, except that loops no longer than grain (or launched on
+   * a single thread pool) run inline as a single call.  An exception thrown
+   * by body is rethrown here once the other sub-ranges have finished.
+   */
+  template <typename Func>
+  void parallelFor(Index_type n, Index_type grain, Func&& body);
+
+  /*!
+   * \brief Start executing body(begin, end) over sub-ranges covering [0, n)
+   *        and return without waiting.
+   *
+   * The returned event owns a copy of body.  Waiting on it executes pool
+   * work on the waiting thread until the loop has completed, then rethrows
+   * any exception thrown by body.  On a single thread pool the loop runs
+   * inline and the returned event is complete.
+   */
+  template <typename Func>
+  AsyncEvent parallelForAsync(Index_type n, Index_type grain, Func&& body);
+
+  /*!
+   * \brief Enqueue task without waiting for it.
+   *
+   * The caller owns task.group and task.data, and must keep them alive until
+   * task.group->done() is observed.  Launches from non-pool threads are dealt
+   * out across all deques; launches from inside the pool are pushed onto the
+   * calling worker's deque and spread by stealing.
+   */
+  void launch(Task const& task);
+
+  //! Execute pool work on the calling thread until group is done.
+  void wait(TaskGroup& group);
+
+private:
+  ThreadPool();
+
+  struct alignas(64) WorkQueue {
+    std::mutex lock;
+    std::deque<Task> tasks;
+  };
+
+  void start(int num_threads);
+  void stop();
+
+  void workerLoop(int id);
+  void push(int id, Task const& task);
+  bool pop(int id, Task& task);
+  bool steal(int id, Task& task);
+  void execute(int id, Task task);
+  void notify();
+
+  std::vector<std::unique_ptr<WorkQueue>> m_queues;
+  std::vector<std::thread> m_workers;
+
+  std::atomic<Index_type> m_pending;
+  std::atomic<int> m_sleeping;
+  std::atomic<bool> m_stop;
+
+  std::mutex m_sleep_lock;
+  std::condition_variable m_wakeup;
+};
+
+template <typename Func>
+RAJA_INLINE void ThreadPool::parallelFor(Index_type n,
+                                         Index_type grain,
+                                         Func&& body)
+{
+  using body_type = typename std::remove_reference<Func>::type;
+
+  if (n <= 0) return;
+  if (grain < 1) grain = 1;
+
+  if (n <= grain || getNumThreads() == 1) {
+    body(Index_type(0), n);
+    return;
+  }
+
+  TaskGroup group(n);
+  Task task{&detail::invokeRange<body_type>,
+            const_cast<void*>(static_cast<const void*>(&body)),
+            0,
+            n,
+            grain,
+            &group};
+  launch(task);
+  wait(group);
+  group.rethrow();
+}
+
+namespace detail
+{
+
+//! Owns the body and completion counter of an asynchronous pool launch.
+template <typename Func>
+class PoolAsyncState : public ::RAJA::detail::AsyncState
+{
+public:
+  PoolAsyncState(Func body, Index_type n) : m_body(std::move(body)), m_group(n)
+  {
+  }
+
+  ~PoolAsyncState() { finish(); }
+
+  bool test() override { return m_group.done(); }
+
+  void wait() override
+  {
+    finish();
+    m_group.rethrow();
+  }
+
+  void finish()
+  {
+    if (!m_group.done()) ThreadPool::getInstance().wait(m_group);
+  }
+
+  Func m_body;
+  TaskGroup m_group;
+};
+
+}  // namespace detail
+
+template <typename Func>
+RAJA_INLINE AsyncEvent ThreadPool::parallelForAsync(Index_type n,
+                                                    Index_type grain,
+                                                    Func&& body)
+{
+  using body_type = typename std::decay<Func>::type;
+
+  if (n <= 0) return AsyncEvent{};
+  if (grain < 1) grain = 1;
+
+  if (getNumThreads() == 1) {
+    body(Index_type(0), n);
+    return AsyncEvent{};
+  }
+
+  auto state = std::make_shared<detail::PoolAsyncState<body_type>>(
+      std::forward<Func>(body), n);
+  Task task{&detail::invokeRange<body_type>,
+            static_cast<void*>(&state->m_body),
+            0,
+            n,
+            grain,
+            &state->m_group};
+  launch(task);
+  return AsyncEvent(std::move(state));
+}
+
+//! Return the number of threads used by the pool.
+RAJA_INLINE int get_num_threads()
+{
+  return ThreadPool::getInstance().getNumThreads();
+}
+
+//! Restart the pool with num_threads threads.
+RAJA_INLINE void set_num_threads(int num_threads)
+{
+  ThreadPool::getInstance().resize(num_threads);
+}
+
+//! Return the pool slot of the calling thread (0 outside of pool workers).
+RAJA_INLINE int get_thread_num() { return ThreadPool::getThreadNum(); }
+
+}  // namespace threads
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_THREADS guard
+
+#endif  // closing endif for header file include guard
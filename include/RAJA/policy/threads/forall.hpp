@@ -0,0 +1,356 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA index set and segment iteration
+ *          template methods for execution on the std::thread pool.
+ *
+ *          These methods should work on any platform that supports
+ *          std::thread.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_threads_HPP
+#define RAJA_forall_threads_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+#include <type_traits>
+
+#include "RAJA/util/AsyncEvent.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/internal/fault_tolerance.hpp"
+
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/policy/threads/ThreadPool.hpp"
+#include "RAJA/policy/threads/policy.hpp"
+
+#include "RAJA/pattern/detail/forall_param.hpp"
+#include "RAJA/pattern/forall.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace threads
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Iterations per task when the policy leaves the grain size to RAJA.
+ *
+ * Aim for several pieces per pool thread so that stealing can even out
+ * imbalance, without splitting short loops into pieces too small to pay for
+ * their scheduling.
+ */
+RAJA_INLINE Index_type autoGrainSize(Index_type len, int num_threads)
+{
+  constexpr Index_type pieces_per_thread = 8;
+  return std::max(Index_type(1), len / (pieces_per_thread * num_threads));
+}
+
+template <typename Iterable, typename Func>
+RAJA_INLINE void forall_pool(Iterable&& iter, Func&& loop_body,
+                             Index_type grain)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+
+  ::RAJA::threads::ThreadPool::getInstance().parallelFor(
+      distance_it, grain, [&](Index_type first, Index_type last) {
+        using RAJA::internal::thread_privatize;
+        auto privatizer = thread_privatize(loop_body);
+        auto& body = privatizer.get_priv();
+        for (Index_type i = first; i < last; ++i) {
+          body(begin_it[i]);
+        }
+      });
+}
+
+/// Owns copies of an asynchronous loop's range and body
+template <typename Iterable, typename Func>
+struct AsyncForallBody {
+  typename std::decay<Iterable>::type iter;
+  typename std::decay<Func>::type loop_body;
+
+  void operator()(Index_type first, Index_type last) const
+  {
+    using std::begin;
+    auto begin_it = begin(iter);
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(loop_body);
+    auto& body = privatizer.get_priv();
+    for (Index_type i = first; i < last; ++i) {
+      body(begin_it[i]);
+    }
+  }
+};
+
+template <typename Iterable, typename Func>
+RAJA_INLINE AsyncEvent forall_pool_async(Iterable&& iter,
+                                         Func&& loop_body,
+                                         Index_type grain)
+{
+  using std::begin;
+  using std::end;
+  const Index_type len = std::distance(begin(iter), end(iter));
+  return ::RAJA::threads::ThreadPool::getInstance().parallelForAsync(
+      len,
+      grain,
+      AsyncForallBody<Iterable, Func>{std::forward<Iterable>(iter),
+                                      std::forward<Func>(loop_body)});
+}
+
+}  // namespace detail
+
+/**
+ * @brief threads dynamic for implementation
+ *
+ * @param threads_for_dynamic threads tag
+ * @param iter any iterable
+ * @param loop_body loop body
+ *
+ * @return None
+ *
+ * The iteration space is split recursively down to GrainSize iterations
+ * (or an automatically chosen grain when GrainSize is 0) and balanced across
+ * the pool by work stealing.  This composes with application threads and
+ * with nested loops, which execute on the same pool.
+ */
+template <typename Iterable, typename Func, size_t GrainSize>
+RAJA_INLINE void forall_impl(const threads_for_dynamic<GrainSize>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  using std::begin;
+  using std::end;
+  const Index_type len = std::distance(begin(iter), end(iter));
+  const Index_type grain =
+      GrainSize > 0 ? static_cast<Index_type>(GrainSize)
+                    : detail::autoGrainSize(
+                          len, ::RAJA::threads::get_num_threads());
+  detail::forall_pool(std::forward<Iterable>(iter),
+                      std::forward<Func>(loop_body),
+                      grain);
+}
+
+/**
+ * @brief threads static for implementation
+ *
+ * @param threads_for_static threads tag
+ * @param iter any iterable
+ * @param loop_body loop body
+ *
+ * @return None
+ *
+ * Every pool thread receives one contiguous block of the iteration space.
+ * This gives the lowest scheduling overhead for well-balanced loops.
+ */
+template <typename Iterable, typename Func>
+RAJA_INLINE void forall_impl(const threads_for_static&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  using std::begin;
+  using std::end;
+  const Index_type len = std::distance(begin(iter), end(iter));
+  const Index_type num_threads = ::RAJA::threads::get_num_threads();
+  detail::forall_pool(std::forward<Iterable>(iter),
+                      std::forward<Func>(loop_body),
+                      (len + num_threads - 1) / num_threads);
+}
+
+///
+/// Chunked implementations; see RAJA::forall_chunked
+///
+
+namespace detail
+{
+
+template <typename Segment, typename Func>
+RAJA_INLINE void forall_chunked_pool(Segment&& seg,
+                                     Func&& loop_body,
+                                     Index_type grain)
+{
+  using diff_type = typename camp::decay<Segment>::IndexType;
+  ::RAJA::threads::ThreadPool::getInstance().parallelFor(
+      static_cast<Index_type>(seg.size()),
+      grain,
+      [&](Index_type first, Index_type last) {
+        using RAJA::internal::thread_privatize;
+        auto privatizer = thread_privatize(loop_body);
+        auto& body = privatizer.get_priv();
+        body(RAJA::detail::range_chunk(seg,
+                                       static_cast<diff_type>(first),
+                                       static_cast<diff_type>(last)));
+      });
+}
+
+}  // namespace detail
+
+//! Each piece the pool runs, of at most the grain size, is one chunk
+template <typename Segment, typename Func, size_t GrainSize>
+RAJA_INLINE void forall_chunked_impl(const threads_for_dynamic<GrainSize>&,
+                                     Segment&& seg,
+                                     Func&& loop_body)
+{
+  const Index_type len = seg.size();
+  const Index_type grain =
+      GrainSize > 0 ? static_cast<Index_type>(GrainSize)
+                    : detail::autoGrainSize(
+                          len, ::RAJA::threads::get_num_threads());
+  detail::forall_chunked_pool(seg, loop_body, grain);
+}
+
+//! Each pool thread's block is one chunk
+template <typename Segment, typename Func>
+RAJA_INLINE void forall_chunked_impl(const threads_for_static&,
+                                     Segment&& seg,
+                                     Func&& loop_body)
+{
+  const Index_type len = seg.size();
+  const Index_type num_threads = ::RAJA::threads::get_num_threads();
+  detail::forall_chunked_pool(seg,
+                              loop_body,
+                              (len + num_threads - 1) / num_threads);
+}
+
+///
+/// Implementations with reduction parameters; see RAJA::forall_param
+///
+
+namespace detail
+{
+
+/*!
+ * \brief Each piece the pool runs accumulates into its own values, which
+ *        are folded into the result under a lock once per piece.
+ */
+template <typename Iterable, typename Func, typename... Params>
+RAJA_INLINE void forall_param_pool(
+    Iterable&& iter,
+    Func const& loop_body,
+    RAJA::detail::ForallParamPack<Params...> const& params,
+    Index_type grain)
+{
+  using values_type =
+      typename RAJA::detail::ForallParamPack<Params...>::values_type;
+  RAJA_EXTRACT_BED_IT(iter);
+
+  values_type result = params.identities();
+  std::mutex result_mutex;
+
+  ::RAJA::threads::ThreadPool::getInstance().parallelFor(
+      distance_it, grain, [&](Index_type first, Index_type last) {
+        values_type values = params.identities();
+        auto body = RAJA::detail::makeForallParamBody(loop_body, values);
+        for (Index_type i = first; i < last; ++i) {
+          body(begin_it[i]);
+        }
+        std::lock_guard<std::mutex> lock(result_mutex);
+        params.combine(result, values);
+      });
+
+  params.finalize(result);
+}
+
+}  // namespace detail
+
+template <typename Iterable,
+          typename Func,
+          size_t GrainSize,
+          typename... Params>
+RAJA_INLINE void forall_param_impl(
+    const threads_for_dynamic<GrainSize>&,
+    Iterable&& iter,
+    RAJA::detail::ForallParamPack<Params...> const& params,
+    Func&& loop_body)
+{
+  using std::begin;
+  using std::end;
+  const Index_type len = std::distance(begin(iter), end(iter));
+  const Index_type grain =
+      GrainSize > 0 ? static_cast<Index_type>(GrainSize)
+                    : detail::autoGrainSize(
+                          len, ::RAJA::threads::get_num_threads());
+  detail::forall_param_pool(iter, loop_body, params, grain);
+}
+
+template <typename Iterable, typename Func, typename... Params>
+RAJA_INLINE void forall_param_impl(
+    const threads_for_static&,
+    Iterable&& iter,
+    RAJA::detail::ForallParamPack<Params...> const& params,
+    Func&& loop_body)
+{
+  using std::begin;
+  using std::end;
+  const Index_type len = std::distance(begin(iter), end(iter));
+  const Index_type num_threads = ::RAJA::threads::get_num_threads();
+  detail::forall_param_pool(
+      iter, loop_body, params, (len + num_threads - 1) / num_threads);
+}
+
+///
+/// Asynchronous implementations; see RAJA::forall_async
+///
+
+template <typename Iterable, typename Func, size_t GrainSize>
+RAJA_INLINE AsyncEvent forall_async_impl(const threads_for_dynamic<GrainSize>&,
+                                         Iterable&& iter,
+                                         Func&& loop_body)
+{
+  using std::begin;
+  using std::end;
+  const Index_type len = std::distance(begin(iter), end(iter));
+  const Index_type grain =
+      GrainSize > 0 ? static_cast<Index_type>(GrainSize)
+                    : detail::autoGrainSize(
+                          len, ::RAJA::threads::get_num_threads());
+  return detail::forall_pool_async(std::forward<Iterable>(iter),
+                                   std::forward<Func>(loop_body),
+                                   grain);
+}
+
+template <typename Iterable, typename Func>
+RAJA_INLINE AsyncEvent forall_async_impl(const threads_for_static&,
+                                         Iterable&& iter,
+                                         Func&& loop_body)
+{
+  using std::begin;
+  using std::end;
+  const Index_type len = std::distance(begin(iter), end(iter));
+  const Index_type num_threads = ::RAJA::threads::get_num_threads();
+  return detail::forall_pool_async(std::forward<Iterable>(iter),
+                                   std::forward<Func>(loop_body),
+                                   (len + num_threads - 1) / num_threads);
+}
+
+}  // namespace threads
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,113 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA std::thread pool policy definitions.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef policy_threads_HPP
+#define policy_threads_HPP
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+#include <cstddef>
+
+namespace RAJA
+{
+namespace policy
+{
+namespace threads
+{
+
+//
+//////////////////////////////////////////////////////////////////////
+//
+// Execution policies
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+///
+/// Segment execution policies
+///
+
+/*!
+ * Work-stealing execution on the persistent thread pool.  The iteration
+ * space is dealt out to the pool workers and recursively split in half until
+ * pieces reach GrainSize iterations; idle workers steal the largest pending
+ * pieces from busy ones.  A GrainSize of zero picks a grain from the loop
+ * length and the pool size.
+ */
+template <std::size_t GrainSize = 0>
+struct threads_for_dynamic
+    : make_policy_pattern_launch_platform_t<Policy::threads,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+/*!
+ * Static execution on the persistent thread pool.  Each pool thread receives
+ * one contiguous block of the iteration space, which is never split further
+ * (a block may still be stolen whole by an idle worker).
+ */
+struct threads_for_static
+    : make_policy_pattern_launch_platform_t<Policy::threads,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+using threads_for_exec = threads_for_dynamic<>;
+
+///
+/// Index set segment iteration policies
+///
+using threads_segit = threads_for_exec;
+
+
+///
+///////////////////////////////////////////////////////////////////////
+///
+/// Reduction execution policies
+///
+///////////////////////////////////////////////////////////////////////
+///
+struct threads_reduce
+    : make_policy_pattern_launch_platform_t<Policy::threads,
+                                            Pattern::reduce,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+struct threads_reduce_reproducible
+    : make_policy_pattern_launch_platform_t<Policy::threads,
+                                            Pattern::reduce,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            reduce::reproducible> {
+};
+
+}  // namespace threads
+}  // namespace policy
+
+using policy::threads::threads_for_dynamic;
+using policy::threads::threads_for_exec;
+using policy::threads::threads_for_static;
+using policy::threads::threads_reduce;
+using policy::threads::threads_reduce_reproducible;
+using policy::threads::threads_segit;
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,106 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA reduction templates for
+ *          std::thread pool execution.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_threads_reduce_HPP
+#define RAJA_threads_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include <mutex>
+
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/detail/reduce_reproducible.hpp"
+#include "RAJA/pattern/reduce.hpp"
+
+#include "RAJA/policy/threads/policy.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! lock guarding the merge of task-private reducer copies into their parent
+RAJA_INLINE std::mutex& threadsReduceMutex()
+{
+  static std::mutex reduce_mutex;
+  return reduce_mutex;
+}
+
+template <typename T, typename Reduce>
+class ReduceThreads
+    : public reduce::detail::BaseCombinable<T, Reduce, ReduceThreads<T, Reduce>>
+{
+  using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceThreads>;
+
+public:
+  using Base::Base;
+  //! prohibit compiler-generated default ctor
+  ReduceThreads() = delete;
+
+  ~ReduceThreads()
+  {
+    if (Base::parent) {
+      std::lock_guard<std::mutex> lock(threadsReduceMutex());
+      Reduce()(Base::parent->local(), Base::my_data);
+      Base::parent = nullptr;
+    }
+  }
+};
+
+//! Reproducible combiner; copies merge under the same lock in any order
+template <typename T, typename Reduce>
+class ReduceThreadsReproducible
+    : public reduce::detail::
+          BaseReproducible<T, Reduce, ReduceThreadsReproducible<T, Reduce>>
+{
+  using Base = reduce::detail::
+      BaseReproducible<T, Reduce, ReduceThreadsReproducible>;
+
+public:
+  using Base::Base;
+  //! prohibit compiler-generated default ctor
+  ReduceThreadsReproducible() = delete;
+
+  ~ReduceThreadsReproducible()
+  {
+    if (Base::parent) {
+      std::lock_guard<std::mutex> lock(threadsReduceMutex());
+      Base::parent->accumulator().merge(Base::my_data);
+      Base::parent = nullptr;
+    }
+  }
+};
+
+}  // namespace detail
+
+RAJA_DECLARE_ALL_REDUCERS(threads_reduce, detail::ReduceThreads)
+RAJA_DECLARE_ARRAY_REDUCER(threads_reduce, detail::ReduceThreads)
+RAJA_DECLARE_GENERIC_REDUCER(threads_reduce, detail::ReduceThreads)
+RAJA_DECLARE_ALL_REDUCERS(threads_reduce_reproducible,
+                          detail::ReduceThreadsReproducible)
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_THREADS guard
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,295 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA scan declarations for the std::thread
+ *          pool back-end.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_scan_threads_HPP
+#define RAJA_scan_threads_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/detail/scan.hpp"
+
+#include "RAJA/policy/threads/ThreadPool.hpp"
+#include "RAJA/policy/threads/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace scan
+{
+
+namespace detail
+{
+
+/*!
+        \brief run a BlockScan with one block per pool thread; the pool runs
+   phase one, then phase two, each as a single parallelFor
+*/
+template <typename Scan>
+void threadsBlockScan(Index_type n, Scan scan)
+{
+  if (n <= 0) {
+    return;
+  }
+  auto& pool = ::RAJA::threads::ThreadPool::getInstance();
+  const Index_type p =
+      std::min(n, static_cast<Index_type>(pool.getNumThreads()));
+  ::std::vector<typename Scan::total_type> sums(p);
+  scan.sums = sums.data();
+  if (p <= 1) {
+    scan.scan(0, 1);
+    return;
+  }
+
+  pool.parallelFor(p - 1, 1, [&](Index_type first, Index_type last) {
+    for (Index_type pid = first; pid < last; ++pid) {
+      scan.reduce(pid, p);
+    }
+  });
+
+  pool.parallelFor(p, 1, [&](Index_type first, Index_type last) {
+    for (Index_type pid = first; pid < last; ++pid) {
+      scan.scan(pid, p);
+    }
+  });
+}
+
+}  // namespace detail
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   unary operation applied to each input element
+*/
+template <typename Policy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename UnaryFn>
+concepts::enable_if<type_traits::is_threads_policy<Policy>> transform_inclusive(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f,
+    UnaryFn op)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  const Index_type n = end - begin;
+  detail::threadsBlockScan(
+      n, detail::makeBlockScan<true>(begin, out, n, f, op, Value()));
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function,
+   unary operation applied to each input element, and initial value
+*/
+template <typename Policy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename UnaryFn,
+          typename ValueT>
+concepts::enable_if<type_traits::is_threads_policy<Policy>> transform_exclusive(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f,
+    UnaryFn op,
+    ValueT v)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  const Index_type n = end - begin;
+  detail::threadsBlockScan(
+      n,
+      detail::makeBlockScan<false>(begin, out, n, f, op, static_cast<Value>(v)));
+}
+
+/*!
+        \brief explicit inclusive inplace scan given range, function, and
+   initial value
+*/
+template <typename Policy, typename Iter, typename BinFn>
+concepts::enable_if<type_traits::is_threads_policy<Policy>> inclusive_inplace(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    BinFn f)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  const Index_type n = end - begin;
+  detail::threadsBlockScan(
+      n,
+      detail::makeBlockScan<true>(
+          begin, begin, n, f, detail::ScanIdentity{}, Value()));
+}
+
+/*!
+        \brief explicit exclusive inplace scan given range, function, and
+   initial value
+*/
+template <typename Policy, typename Iter, typename BinFn, typename ValueT>
+concepts::enable_if<type_traits::is_threads_policy<Policy>> exclusive_inplace(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    BinFn f,
+    ValueT v)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  const Index_type n = end - begin;
+  detail::threadsBlockScan(
+      n,
+      detail::makeBlockScan<false>(begin,
+                                   begin,
+                                   n,
+                                   f,
+                                   detail::ScanIdentity{},
+                                   static_cast<Value>(v)));
+}
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   initial value
+*/
+template <typename Policy, typename Iter, typename OutIter, typename BinFn>
+concepts::enable_if<type_traits::is_threads_policy<Policy>> inclusive(
+    const Policy& exec,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f)
+{
+  transform_inclusive(exec, begin, end, out, f, detail::ScanIdentity{});
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function, and
+   initial value
+*/
+template <typename Policy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename ValueT>
+concepts::enable_if<type_traits::is_threads_policy<Policy>> exclusive(
+    const Policy& exec,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f,
+    ValueT v)
+{
+  transform_exclusive(exec, begin, end, out, f, detail::ScanIdentity{}, v);
+}
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   segment head predicate; the scan restarts at every index i with head(i)
+*/
+template <typename Policy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename HeadFn>
+concepts::enable_if<type_traits::is_threads_policy<Policy>> inclusive_segmented(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f,
+    HeadFn head)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  const Index_type n = end - begin;
+  detail::threadsBlockScan(
+      n,
+      detail::makeSegmentedBlockScan<true>(begin, out, n, f, head, Value()));
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function,
+   segment head predicate, and initial value of every segment
+*/
+template <typename Policy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename HeadFn,
+          typename ValueT>
+concepts::enable_if<type_traits::is_threads_policy<Policy>> exclusive_segmented(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f,
+    HeadFn head,
+    ValueT v)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  const Index_type n = end - begin;
+  detail::threadsBlockScan(n,
+                          detail::makeSegmentedBlockScan<false>(
+                              begin, out, n, f, head, static_cast<Value>(v)));
+}
+
+/*!
+        \brief stable compaction of the range of n elements at begin: element
+   i goes in order to out_true if sel(i) and to out_false otherwise; returns
+   the number of elements written to out_true
+*/
+template <typename Policy,
+          typename Iter,
+          typename OutTrue,
+          typename OutFalse,
+          typename SelectFn>
+typename std::enable_if<type_traits::is_threads_policy<Policy>::value,
+                        Index_type>::type
+compact(const Policy&,
+        Iter begin,
+        Index_type n,
+        OutTrue out_true,
+        OutFalse out_false,
+        SelectFn sel)
+{
+  Index_type count = 0;
+  detail::threadsBlockScan(
+      n,
+      detail::makeCompactBlocks(begin, out_true, out_false, n, sel, &count));
+  return count;
+}
+
+}  // namespace scan
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
+
+#endif  // closing endif for header file include guard
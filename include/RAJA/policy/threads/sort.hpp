@@ -0,0 +1,150 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_threads_HPP
+#define RAJA_sort_threads_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/detail/sort.hpp"
+
+#include "RAJA/policy/threads/ThreadPool.hpp"
+#include "RAJA/policy/threads/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+namespace detail
+{
+
+//! for_blocks that runs the blocks on the persistent thread pool
+struct ThreadsForBlocks {
+  template <typename Body>
+  void operator()(Index_type m, Body body) const
+  {
+    ::RAJA::threads::ThreadPool::getInstance().parallelFor(
+        m, 1, [&](Index_type first, Index_type last) {
+          for (Index_type i = first; i < last; ++i) {
+            body(i);
+          }
+        });
+  }
+};
+
+}  // namespace detail
+
+/*!
+        \brief sort given range and comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_threads_policy<ExecPolicy>> unstable(
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  detail::sortEngine<false>(
+      detail::ThreadsForBlocks{},
+      ::RAJA::threads::ThreadPool::getInstance().getNumThreads(),
+      begin,
+      end,
+      comp);
+}
+
+/*!
+        \brief stable sort given range and comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_threads_policy<ExecPolicy>> stable(
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  detail::sortEngine<true>(
+      detail::ThreadsForBlocks{},
+      ::RAJA::threads::ThreadPool::getInstance().getNumThreads(),
+      begin,
+      end,
+      comp);
+}
+
+/*!
+        \brief sort given key range, value range, and comparison function
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_threads_policy<ExecPolicy>> unstable_pairs(
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  detail::sortPairsEngine<false>(
+      detail::ThreadsForBlocks{},
+      ::RAJA::threads::ThreadPool::getInstance().getNumThreads(),
+      keys_begin,
+      keys_end,
+      vals_begin,
+      comp);
+}
+
+/*!
+        \brief stable sort given key range, value range, and comparison
+   function
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_threads_policy<ExecPolicy>> stable_pairs(
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  detail::sortPairsEngine<true>(
+      detail::ThreadsForBlocks{},
+      ::RAJA::threads::ThreadPool::getInstance().getNumThreads(),
+      keys_begin,
+      keys_end,
+      vals_begin,
+      comp);
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,77 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA transform-reduce declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_transform_reduce_threads_HPP
+#define RAJA_transform_reduce_threads_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/detail/transform_reduce.hpp"
+
+#include "RAJA/policy/threads/ThreadPool.hpp"
+#include "RAJA/policy/threads/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace transform_reduce
+{
+
+/*!
+        \brief reduce f(i) over i in [0, n) with op, starting from init
+*/
+template <typename ExecPolicy, typename T, typename BinFn, typename Fn>
+typename std::enable_if<
+    type_traits::is_threads_policy<ExecPolicy>::value, T>::type
+reduce(const ExecPolicy&, Index_type n, T init, BinFn op, Fn f)
+{
+  if (n <= 0) {
+    return init;
+  }
+  const Index_type p = std::min(
+      n,
+      static_cast<Index_type>(
+          ::RAJA::threads::ThreadPool::getInstance().getNumThreads()));
+  std::vector<detail::BlockPartial<T>> partials(p);
+  ::RAJA::threads::ThreadPool::getInstance().parallelFor(
+      p, 1, [&](Index_type first, Index_type last) {
+        for (Index_type pid = first; pid < last; ++pid) {
+          detail::reduceBlock(n, p, pid, op, f, partials[pid]);
+        }
+      });
+  return detail::combinePartials(init, op, partials.data(), p);
+}
+
+}  // namespace transform_reduce
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
+
+#endif  // closing endif for header file include guard
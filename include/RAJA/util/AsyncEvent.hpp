@@ -0,0 +1,230 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining the event returned by asynchronous RAJA
+ *          host launches.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_AsyncEvent_HPP
+#define RAJA_util_AsyncEvent_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Completion state shared by an AsyncEvent and the work it tracks.
+ *
+ * Implementations must keep everything the work refers to alive until it
+ * has completed, and must wait for the work in their destructor.  wait()
+ * rethrows an exception thrown by the work; the destructor does not.
+ */
+class AsyncState
+{
+public:
+  virtual ~AsyncState() {}
+
+  //! return true if the work has completed
+  virtual bool test() = 0;
+
+  //! block until the work has completed
+  virtual void wait() = 0;
+};
+
+/*!
+ * \brief Work running on a std::thread of its own, for builds without the
+ *        threads back-end pool.
+ */
+class DedicatedThreadAsyncState : public AsyncState
+{
+public:
+  template <typename Func>
+  explicit DedicatedThreadAsyncState(Func func)
+      : m_done(false),
+        m_thread(&DedicatedThreadAsyncState::run<Func>, this, std::move(func))
+  {
+  }
+
+  ~DedicatedThreadAsyncState() { finish(); }
+
+  bool test() override { return m_done.load(std::memory_order_acquire); }
+
+  void wait() override
+  {
+    finish();
+    if (m_error) std::rethrow_exception(m_error);
+  }
+
+private:
+  template <typename Func>
+  void run(Func func)
+  {
+    try {
+      func();
+    } catch (...) {
+      m_error = std::current_exception();
+    }
+    m_done.store(true, std::memory_order_release);
+  }
+
+  void finish()
+  {
+    std::lock_guard<std::mutex> lock(m_join_lock);
+    if (m_thread.joinable()) m_thread.join();
+  }
+
+  std::atomic<bool> m_done;
+  std::exception_ptr m_error;
+  std::mutex m_join_lock;
+  std::thread m_thread;
+};
+
+/*!
+ * \brief Wraps the state of some work and runs a callback once, on the
+ *        thread that first observes that the work has completed.
+ */
+template <typename Callback>
+class AsyncCompletionState : public AsyncState
+{
+public:
+  AsyncCompletionState(std::shared_ptr<AsyncState> work, Callback callback)
+      : m_work(std::move(work)), m_callback(std::move(callback))
+  {
+  }
+
+  ~AsyncCompletionState()
+  {
+    // a destructor cannot report a failure of the work, so drop it
+    try {
+      m_work->wait();
+    } catch (...) {
+    }
+    complete();
+  }
+
+  bool test() override
+  {
+    if (!m_work->test()) return false;
+    complete();
+    return true;
+  }
+
+  void wait() override
+  {
+    try {
+      m_work->wait();
+    } catch (...) {
+      complete();
+      throw;
+    }
+    complete();
+  }
+
+private:
+  void complete() { std::call_once(m_once, m_callback); }
+
+  std::shared_ptr<AsyncState> m_work;
+  Callback m_callback;
+  std::once_flag m_once;
+};
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Lightweight handle on work launched by an asynchronous RAJA call.
+ *
+ *         Copies of an event refer to the same work.  A default constructed
+ *         event is already complete.  When the last copy of an event is
+ *         destroyed before its work has completed, the destructor waits for
+ *         it, so loop bodies never outlive the data they capture by value.
+ *
+ * Usage example:
+ *
+ * \verbatim
+ *
+ *   RAJA::AsyncEvent flux = RAJA::forall_async<RAJA::threads_for_exec>(
+ *       RAJA::RangeSegment(0, N), [=](int i) { ... });
+ *   RAJA::AsyncEvent src = RAJA::forall_async<RAJA::threads_for_exec>(
+ *       RAJA::RangeSegment(0, N), [=](int i) { ... });
+ *
+ *   flux.wait();
+ *   src.wait();
+ *
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+class AsyncEvent
+{
+public:
+  AsyncEvent() = default;
+
+  explicit AsyncEvent(std::shared_ptr<detail::AsyncState> state)
+      : m_state(std::move(state))
+  {
+  }
+
+  //! return true if the work has completed, without blocking
+  bool test() const { return !m_state || m_state->test(); }
+
+  //! block until the work has completed; rethrows an exception it threw
+  void wait()
+  {
+    if (m_state) {
+      m_state->wait();
+      m_state.reset();
+    }
+  }
+
+  /*!
+   * \brief Run callback once the work has completed.
+   *
+   * The callback runs on the thread that first observes completion, through
+   * wait(), a test() that returns true, or the destruction of the last copy
+   * of this event.  It runs immediately if the event is already complete.
+   * Copies of this event made before the call do not run it.
+   */
+  template <typename Callback>
+  void onCompletion(Callback&& callback)
+  {
+    using callback_type = typename std::decay<Callback>::type;
+    if (m_state) {
+      m_state = std::make_shared<detail::AsyncCompletionState<callback_type>>(
+          std::move(m_state), std::forward<Callback>(callback));
+    } else {
+      callback();
+    }
+  }
+
+private:
+  std::shared_ptr<detail::AsyncState> m_state;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,760 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining SIMD register, mask and index pack
+ *          types used with the vector_exec policy.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_VectorRegister_HPP
+#define RAJA_util_VectorRegister_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+//
+// With GCC-compatible compilers registers are built on the compiler's
+// generic vector types, which are lowered to SSE, AVX2 or AVX-512
+// instructions according to the target flags.  Other compilers get a
+// portable implementation operating on one lane at a time.
+//
+#if defined(__GNUC__) && !defined(__CUDA_ARCH__) \
+    && !defined(__HIP_DEVICE_COMPILE__)
+#define RAJA_VECTOR_EXTENSIONS
+#endif
+
+#if defined(__AVX512F__)
+#define RAJA_NATIVE_VECTOR_BYTES 64
+#elif defined(__AVX__)
+#define RAJA_NATIVE_VECTOR_BYTES 32
+#else
+#define RAJA_NATIVE_VECTOR_BYTES 16
+#endif
+
+namespace RAJA
+{
+
+//! Number of lanes of type T in a native SIMD register of the target
+template <typename T>
+struct native_vector_width
+    : std::integral_constant<size_t,
+                             (RAJA_NATIVE_VECTOR_BYTES > sizeof(T)
+                                  ? RAJA_NATIVE_VECTOR_BYTES / sizeof(T)
+                                  : 1)> {
+};
+
+namespace detail
+{
+
+template <typename T, size_t Width>
+struct vector_storage {
+#if defined(RAJA_VECTOR_EXTENSIONS)
+  typedef T type __attribute__((vector_size(sizeof(T) * Width)));
+  using mask_type = decltype(type{} < type{});
+#else
+  struct type {
+    T lane[Width];
+    RAJA_INLINE T& operator[](size_t l) { return lane[l]; }
+    RAJA_INLINE T const& operator[](size_t l) const { return lane[l]; }
+  };
+  struct mask_type {
+    bool lane[Width];
+    RAJA_INLINE bool& operator[](size_t l) { return lane[l]; }
+    RAJA_INLINE bool const& operator[](size_t l) const { return lane[l]; }
+  };
+#endif
+};
+
+}  // namespace detail
+
+//
+// Lane-wise operations: one vector expression with vector extensions, a
+// loop over the lanes otherwise.
+//
+#if defined(RAJA_VECTOR_EXTENSIONS)
+#define RAJA_VECTOR_LANEWISE(res, a, OP, b) res = a OP b;
+#else
+#define RAJA_VECTOR_LANEWISE(res, a, OP, b) \
+  for (size_t l = 0; l < Width; ++l) {      \
+    res[l] = a[l] OP b[l];                  \
+  }
+#endif
+
+template <typename T, size_t Width>
+class VectorRegister;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Per-lane predicate for a VectorRegister<T, Width>, produced by
+ *         comparisons and consumed by blend().
+ *
+ ******************************************************************************
+ */
+template <typename T, size_t Width>
+class VectorMask
+{
+public:
+  using storage_type = typename detail::vector_storage<T, Width>::mask_type;
+  static constexpr size_t width = Width;
+
+  //! All lanes false
+  RAJA_INLINE VectorMask() : m_value() {}
+
+  RAJA_INLINE explicit VectorMask(storage_type value) : m_value(value) {}
+
+  //! Mask of the lanes of another element type
+  template <typename U>
+  RAJA_INLINE explicit VectorMask(VectorMask<U, Width> const& other)
+      : m_value()
+  {
+    for (size_t l = 0; l < Width; ++l) {
+      set(l, other[l]);
+    }
+  }
+
+  //! Mask whose first n lanes are true
+  RAJA_INLINE static VectorMask first_n(size_t n)
+  {
+    VectorMask mask;
+    for (size_t l = 0; l < Width && l < n; ++l) {
+      mask.set(l, true);
+    }
+    return mask;
+  }
+
+  RAJA_INLINE bool operator[](size_t lane) const { return m_value[lane] != 0; }
+
+  RAJA_INLINE void set(size_t lane, bool value)
+  {
+#if defined(RAJA_VECTOR_EXTENSIONS)
+    m_value[lane] = value ? -1 : 0;
+#else
+    m_value[lane] = value;
+#endif
+  }
+
+  RAJA_INLINE bool any() const
+  {
+    for (size_t l = 0; l < Width; ++l) {
+      if (m_value[l]) return true;
+    }
+    return false;
+  }
+
+  RAJA_INLINE bool all() const
+  {
+    for (size_t l = 0; l < Width; ++l) {
+      if (!m_value[l]) return false;
+    }
+    return true;
+  }
+
+  RAJA_INLINE VectorMask operator&(VectorMask const& b) const
+  {
+#if defined(RAJA_VECTOR_EXTENSIONS)
+    return VectorMask(m_value & b.m_value);
+#else
+    VectorMask r;
+    for (size_t l = 0; l < Width; ++l) {
+      r.m_value[l] = m_value[l] && b.m_value[l];
+    }
+    return r;
+#endif
+  }
+
+  RAJA_INLINE VectorMask operator|(VectorMask const& b) const
+  {
+#if defined(RAJA_VECTOR_EXTENSIONS)
+    return VectorMask(m_value | b.m_value);
+#else
+    VectorMask r;
+    for (size_t l = 0; l < Width; ++l) {
+      r.m_value[l] = m_value[l] || b.m_value[l];
+    }
+    return r;
+#endif
+  }
+
+  RAJA_INLINE VectorMask operator!() const
+  {
+#if defined(RAJA_VECTOR_EXTENSIONS)
+    return VectorMask(~m_value);
+#else
+    VectorMask r;
+    for (size_t l = 0; l < Width; ++l) {
+      r.m_value[l] = !m_value[l];
+    }
+    return r;
+#endif
+  }
+
+  RAJA_INLINE storage_type const& get() const { return m_value; }
+
+private:
+  storage_type m_value;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Width lanes of type T held in a SIMD register.
+ *
+ *         Arithmetic and comparison operators act lane by lane; scalars are
+ *         broadcast to all lanes.  Width must be a power of two.
+ *
+ ******************************************************************************
+ */
+template <typename T, size_t Width>
+class VectorRegister
+{
+  static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value,
+                "VectorRegister needs an arithmetic element type");
+  static_assert(Width > 0 && (Width & (Width - 1)) == 0,
+                "VectorRegister width must be a power of two");
+
+public:
+  using value_type = T;
+  using storage_type = typename detail::vector_storage<T, Width>::type;
+  using mask_type = VectorMask<T, Width>;
+  static constexpr size_t width = Width;
+
+  //! All lanes zero
+  RAJA_INLINE VectorRegister() : m_value() {}
+
+  //! Broadcast value to all lanes
+  RAJA_INLINE VectorRegister(T value) : m_value()
+  {
+#if defined(RAJA_VECTOR_EXTENSIONS)
+    m_value = m_value + value;
+#else
+    for (size_t l = 0; l < Width; ++l) {
+      m_value[l] = value;
+    }
+#endif
+  }
+
+  RAJA_INLINE explicit VectorRegister(storage_type value) : m_value(value) {}
+
+  //! Load len consecutive values from ptr; lanes from len on are zero.
+  RAJA_INLINE static VectorRegister load(T const* ptr, size_t len = Width)
+  {
+    VectorRegister r;
+    if (len >= Width) {
+      std::memcpy(&r.m_value, ptr, sizeof(storage_type));
+    } else {
+      for (size_t l = 0; l < len; ++l) {
+        r.m_value[l] = ptr[l];
+      }
+    }
+    return r;
+  }
+
+  //! Load len values stride elements apart; lanes from len on are zero.
+  RAJA_INLINE static VectorRegister load_strided(T const* ptr,
+                                                 Index_type stride,
+                                                 size_t len = Width)
+  {
+    VectorRegister r;
+    for (size_t l = 0; l < Width && l < len; ++l) {
+      r.m_value[l] = ptr[static_cast<Index_type>(l) * stride];
+    }
+    return r;
+  }
+
+  //! Store the first len lanes to consecutive elements at ptr.
+  RAJA_INLINE void store(T* ptr, size_t len = Width) const
+  {
+    if (len >= Width) {
+      std::memcpy(ptr, &m_value, sizeof(storage_type));
+    } else {
+      for (size_t l = 0; l < len; ++l) {
+        ptr[l] = m_value[l];
+      }
+    }
+  }
+
+  //! Store the first len lanes to elements stride apart.
+  RAJA_INLINE void store_strided(T* ptr,
+                                 Index_type stride,
+                                 size_t len = Width) const
+  {
+    for (size_t l = 0; l < Width && l < len; ++l) {
+      ptr[static_cast<Index_type>(l) * stride] = m_value[l];
+    }
+  }
+
+  RAJA_INLINE T operator[](size_t lane) const { return m_value[lane]; }
+
+  RAJA_INLINE void set(size_t lane, T value) { m_value[lane] = value; }
+
+  RAJA_INLINE storage_type const& get() const { return m_value; }
+
+  RAJA_INLINE VectorRegister& operator+=(VectorRegister const& b)
+  {
+    RAJA_VECTOR_LANEWISE(m_value, m_value, +, b.m_value)
+    return *this;
+  }
+
+  RAJA_INLINE VectorRegister& operator-=(VectorRegister const& b)
+  {
+    RAJA_VECTOR_LANEWISE(m_value, m_value, -, b.m_value)
+    return *this;
+  }
+
+  RAJA_INLINE VectorRegister& operator*=(VectorRegister const& b)
+  {
+    RAJA_VECTOR_LANEWISE(m_value, m_value, *, b.m_value)
+    return *this;
+  }
+
+  RAJA_INLINE VectorRegister& operator/=(VectorRegister const& b)
+  {
+    RAJA_VECTOR_LANEWISE(m_value, m_value, /, b.m_value)
+    return *this;
+  }
+
+  RAJA_INLINE VectorRegister operator-() const
+  {
+    return VectorRegister() -= *this;
+  }
+
+  RAJA_INLINE mask_type operator<(VectorRegister const& b) const
+  {
+    typename mask_type::storage_type m;
+    RAJA_VECTOR_LANEWISE(m, m_value, <, b.m_value)
+    return mask_type(m);
+  }
+
+  RAJA_INLINE mask_type operator<=(VectorRegister const& b) const
+  {
+    typename mask_type::storage_type m;
+    RAJA_VECTOR_LANEWISE(m, m_value, <=, b.m_value)
+    return mask_type(m);
+  }
+
+  RAJA_INLINE mask_type operator>(VectorRegister const& b) const
+  {
+    return b < *this;
+  }
+
+  RAJA_INLINE mask_type operator>=(VectorRegister const& b) const
+  {
+    return b <= *this;
+  }
+
+  RAJA_INLINE mask_type operator==(VectorRegister const& b) const
+  {
+    typename mask_type::storage_type m;
+    RAJA_VECTOR_LANEWISE(m, m_value, ==, b.m_value)
+    return mask_type(m);
+  }
+
+  RAJA_INLINE mask_type operator!=(VectorRegister const& b) const
+  {
+    return !(*this == b);
+  }
+
+  //! Sum of all lanes
+  RAJA_INLINE T sum() const
+  {
+    T s = m_value[0];
+    for (size_t l = 1; l < Width; ++l) {
+      s += m_value[l];
+    }
+    return s;
+  }
+
+  //! Smallest lane
+  RAJA_INLINE T min() const
+  {
+    T m = m_value[0];
+    for (size_t l = 1; l < Width; ++l) {
+      m = m_value[l] < m ? m_value[l] : m;
+    }
+    return m;
+  }
+
+  //! Largest lane
+  RAJA_INLINE T max() const
+  {
+    T m = m_value[0];
+    for (size_t l = 1; l < Width; ++l) {
+      m = m_value[l] > m ? m_value[l] : m;
+    }
+    return m;
+  }
+
+private:
+  storage_type m_value;
+};
+
+#undef RAJA_VECTOR_LANEWISE
+
+template <typename T, size_t Width>
+constexpr size_t VectorRegister<T, Width>::width;
+
+template <typename T, size_t Width>
+constexpr size_t VectorMask<T, Width>::width;
+
+//! Lanes of a where mask is set, lanes of b elsewhere
+template <typename T, size_t Width>
+RAJA_INLINE VectorRegister<T, Width> blend(VectorMask<T, Width> const& mask,
+                                           VectorRegister<T, Width> const& a,
+                                           VectorRegister<T, Width> const& b)
+{
+#if defined(RAJA_VECTOR_EXTENSIONS)
+  using storage_type = typename VectorRegister<T, Width>::storage_type;
+  using mask_storage = typename VectorMask<T, Width>::storage_type;
+  const mask_storage bits = (mask.get() & (mask_storage)a.get())
+                            | (~mask.get() & (mask_storage)b.get());
+  return VectorRegister<T, Width>((storage_type)bits);
+#else
+  VectorRegister<T, Width> r;
+  for (size_t l = 0; l < Width; ++l) {
+    r.set(l, mask[l] ? a[l] : b[l]);
+  }
+  return r;
+#endif
+}
+
+//! Lane-wise minimum
+template <typename T, size_t Width>
+RAJA_INLINE VectorRegister<T, Width> min(VectorRegister<T, Width> const& a,
+                                         VectorRegister<T, Width> const& b)
+{
+  return blend(b < a, b, a);
+}
+
+//! Lane-wise maximum
+template <typename T, size_t Width>
+RAJA_INLINE VectorRegister<T, Width> max(VectorRegister<T, Width> const& a,
+                                         VectorRegister<T, Width> const& b)
+{
+  return blend(a < b, b, a);
+}
+
+//! Lane-wise square root
+template <typename T, size_t Width>
+RAJA_INLINE VectorRegister<T, Width> sqrt(VectorRegister<T, Width> const& a)
+{
+  VectorRegister<T, Width> r;
+  for (size_t l = 0; l < Width; ++l) {
+    r.set(l, std::sqrt(a[l]));
+  }
+  return r;
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Up to Width consecutive values of a View, obtained by indexing the
+ *         View with a VectorIndex.
+ *
+ *         Reading converts to a VectorRegister; assigning stores the lanes
+ *         of a register.  Only the lanes of the VectorIndex are accessed, so
+ *         the last, partial pack of a loop stays within the View.
+ *
+ ******************************************************************************
+ */
+template <typename T, size_t Width>
+class VectorRef
+{
+public:
+  using value_type = typename std::remove_const<T>::type;
+  using register_type = VectorRegister<value_type, Width>;
+
+  RAJA_INLINE VectorRef(T* ptr, Index_type stride, size_t length)
+      : m_ptr(ptr), m_stride(stride), m_length(length)
+  {
+  }
+
+  VectorRef(VectorRef const&) = default;
+
+  RAJA_INLINE register_type load() const
+  {
+    return m_stride == 1
+               ? register_type::load(m_ptr, m_length)
+               : register_type::load_strided(m_ptr, m_stride, m_length);
+  }
+
+  RAJA_INLINE operator register_type() const { return load(); }
+
+  RAJA_INLINE VectorRef const& operator=(register_type const& value) const
+  {
+    if (m_stride == 1) {
+      value.store(m_ptr, m_length);
+    } else {
+      value.store_strided(m_ptr, m_stride, m_length);
+    }
+    return *this;
+  }
+
+  RAJA_INLINE VectorRef const& operator=(VectorRef const& rhs) const
+  {
+    return *this = rhs.load();
+  }
+
+  template <typename B>
+  RAJA_INLINE VectorRef const& operator+=(B const& b) const
+  {
+    return *this = load() + b;
+  }
+
+  template <typename B>
+  RAJA_INLINE VectorRef const& operator-=(B const& b) const
+  {
+    return *this = load() - b;
+  }
+
+  template <typename B>
+  RAJA_INLINE VectorRef const& operator*=(B const& b) const
+  {
+    return *this = load() * b;
+  }
+
+  template <typename B>
+  RAJA_INLINE VectorRef const& operator/=(B const& b) const
+  {
+    return *this = load() / b;
+  }
+
+private:
+  T* m_ptr;
+  Index_type m_stride;
+  size_t m_length;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Pack of up to Width consecutive loop indices, passed by
+ *         vector_exec to the loop body.
+ *
+ *         Indexing a View with a VectorIndex accesses the elements of all
+ *         lanes at once.  size() is Width except for the last pack of a
+ *         loop whose length is not a multiple of Width.
+ *
+ ******************************************************************************
+ */
+template <typename IdxT, size_t Width>
+class VectorIndex
+{
+public:
+  using index_type = IdxT;
+  static constexpr size_t width = Width;
+
+  RAJA_INLINE explicit VectorIndex(IdxT first, size_t length = Width)
+      : m_first(first), m_length(length)
+  {
+  }
+
+  //! Index of lane 0
+  RAJA_INLINE IdxT first() const { return m_first; }
+
+  //! Number of active lanes
+  RAJA_INLINE size_t size() const { return m_length; }
+
+  RAJA_INLINE bool full() const { return m_length == Width; }
+
+  //! Mask of the active lanes, for use with registers of type T
+  template <typename T = IdxT>
+  RAJA_INLINE VectorMask<T, Width> mask() const
+  {
+    return VectorMask<T, Width>::first_n(m_length);
+  }
+
+  //! The index of every lane
+  RAJA_INLINE VectorRegister<IdxT, Width> value() const
+  {
+    VectorRegister<IdxT, Width> r;
+    for (size_t l = 0; l < Width; ++l) {
+      r.set(l, static_cast<IdxT>(m_first + static_cast<IdxT>(l)));
+    }
+    return r;
+  }
+
+private:
+  IdxT m_first;
+  size_t m_length;
+};
+
+template <typename IdxT, size_t Width>
+constexpr size_t VectorIndex<IdxT, Width>::width;
+
+namespace detail
+{
+
+//! Register type of a vector operand; void for scalars
+template <typename A>
+struct vector_register_of {
+  using type = void;
+};
+
+template <typename T, size_t Width>
+struct vector_register_of<VectorRegister<T, Width>> {
+  using type = VectorRegister<T, Width>;
+};
+
+template <typename T, size_t Width>
+struct vector_register_of<VectorRef<T, Width>> {
+  using type = typename VectorRef<T, Width>::register_type;
+};
+
+//! Result of a binary operator of which at least one operand is a vector
+template <typename A,
+          typename B,
+          typename RA = typename vector_register_of<A>::type,
+          typename RB = typename vector_register_of<B>::type>
+struct vector_binary_result {
+  using type = RA;
+};
+
+template <typename A, typename B, typename RB>
+struct vector_binary_result<A, B, void, RB> {
+  using type = RB;
+};
+
+template <typename A, typename B>
+struct vector_binary_result<A, B, void, void> {
+};
+
+template <typename R, typename A>
+RAJA_INLINE R to_register(A const& a)
+{
+  return R(a);
+}
+
+template <typename R, typename T, size_t Width>
+RAJA_INLINE R to_register(VectorRef<T, Width> const& a)
+{
+  return a.load();
+}
+
+//! Arguments of a View access with a VectorIndex replaced by a lane index
+template <typename Arg>
+RAJA_INLINE Arg vector_lane_index(Arg arg, size_t)
+{
+  return arg;
+}
+
+template <typename IdxT, size_t Width>
+RAJA_INLINE IdxT vector_lane_index(VectorIndex<IdxT, Width> const& arg,
+                                   size_t lane)
+{
+  return static_cast<IdxT>(arg.first() + static_cast<IdxT>(lane));
+}
+
+template <typename Arg>
+struct is_vector_index : std::false_type {
+  static constexpr size_t width = 0;
+};
+
+template <typename IdxT, size_t Width>
+struct is_vector_index<VectorIndex<IdxT, Width>> : std::true_type {
+  static constexpr size_t width = Width;
+};
+
+//! Number of VectorIndex arguments, their width, and their active lanes
+template <typename... Args>
+struct vector_index_args {
+  static constexpr size_t count = 0;
+  static constexpr size_t width = 0;
+};
+
+template <typename Arg, typename... Args>
+struct vector_index_args<Arg, Args...> {
+  using rest = vector_index_args<Args...>;
+  static constexpr size_t count =
+      rest::count + (is_vector_index<Arg>::value ? 1 : 0);
+  static constexpr size_t width =
+      is_vector_index<Arg>::value ? is_vector_index<Arg>::width : rest::width;
+};
+
+template <typename Arg>
+RAJA_INLINE size_t vector_index_size(Arg const&)
+{
+  return size_t(-1);
+}
+
+template <typename IdxT, size_t Width>
+RAJA_INLINE size_t vector_index_size(VectorIndex<IdxT, Width> const& arg)
+{
+  return arg.size();
+}
+
+template <typename... Args>
+RAJA_INLINE size_t vector_index_min_size(Args const&... args)
+{
+  size_t size = size_t(-1);
+  size_t sizes[] = {vector_index_size(args)...};
+  for (size_t s : sizes) {
+    size = s < size ? s : size;
+  }
+  return size;
+}
+
+}  // namespace detail
+
+//
+// Operators with at least one vector operand.  VectorRef operands are
+// loaded and scalar operands broadcast.
+//
+#define RAJA_VECTOR_BINARY_OP(OP, RESULT)                                    \
+  template <typename A, typename B>                                         \
+  RAJA_INLINE RESULT operator OP(A const& a, B const& b)                    \
+  {                                                                         \
+    using R = typename detail::vector_binary_result<A, B>::type;            \
+    return detail::to_register<R>(a) OP detail::to_register<R>(b);          \
+  }
+
+#define RAJA_VECTOR_ARITHMETIC_OP(OP)                                        \
+  template <typename A, typename B>                                         \
+  RAJA_INLINE typename detail::vector_binary_result<A, B>::type operator OP( \
+      A const& a, B const& b)                                               \
+  {                                                                         \
+    using R = typename detail::vector_binary_result<A, B>::type;            \
+    R r = detail::to_register<R>(a);                                        \
+    r OP## = detail::to_register<R>(b);                                     \
+    return r;                                                               \
+  }
+
+RAJA_VECTOR_ARITHMETIC_OP(+)
+RAJA_VECTOR_ARITHMETIC_OP(-)
+RAJA_VECTOR_ARITHMETIC_OP(*)
+RAJA_VECTOR_ARITHMETIC_OP(/)
+
+#define RAJA_VECTOR_MASK_RESULT \
+  typename detail::vector_binary_result<A, B>::type::mask_type
+
+RAJA_VECTOR_BINARY_OP(<, RAJA_VECTOR_MASK_RESULT)
+RAJA_VECTOR_BINARY_OP(<=, RAJA_VECTOR_MASK_RESULT)
+RAJA_VECTOR_BINARY_OP(>, RAJA_VECTOR_MASK_RESULT)
+RAJA_VECTOR_BINARY_OP(>=, RAJA_VECTOR_MASK_RESULT)
+RAJA_VECTOR_BINARY_OP(==, RAJA_VECTOR_MASK_RESULT)
+RAJA_VECTOR_BINARY_OP(!=, RAJA_VECTOR_MASK_RESULT)
+
+#undef RAJA_VECTOR_MASK_RESULT
+#undef RAJA_VECTOR_ARITHMETIC_OP
+#undef RAJA_VECTOR_BINARY_OP
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -26,6 +26,8 @@
 
 #include "RAJA/util/Layout.hpp"
 #include "RAJA/util/OffsetLayout.hpp"
+#include "RAJA/util/VectorRegister.hpp"
+#include "RAJA/util/streaming.hpp"
 
 namespace RAJA
 {
@@ -56,6 +58,8 @@ struct View {
   using nc_pointer_type = typename std::add_pointer<typename std::remove_const<
       typename std::remove_pointer<pointer_type>::type>::type>::type;
   using NonConstView = View<nc_value_type, layout_type, nc_pointer_type>;
+  //! value_type& for raw pointers, a proxy for types like streaming_ptr
+  using reference = decltype(std::declval<pointer_type const &>()[0]);
 
   layout_type const layout;
   pointer_type data;
@@ -90,7 +94,9 @@ struct View {
   RAJA_INLINE void set_data(pointer_type data_ptr) { data = data_ptr; }
 
   template <size_t n_dims=layout_type::n_dims, typename IdxLin = Index_type>
-  RAJA_INLINE RAJA::View<ValueType, typename add_offset<layout_type>::type>
+  RAJA_INLINE RAJA::View<ValueType,
+                         typename add_offset<layout_type>::type,
+                         PointerType>
   shift(const std::array<IdxLin, n_dims>& shift)
   {
     static_assert(n_dims==layout_type::n_dims, "Dimension mismatch in view shift");
@@ -98,19 +104,50 @@ struct View {
     typename add_offset<layout_type>::type shift_layout(layout);
     shift_layout.shift(shift);
 
-    return RAJA::View<ValueType, typename add_offset<layout_type>::type>(data, shift_layout);
+    return RAJA::View<ValueType,
+                      typename add_offset<layout_type>::type,
+                      PointerType>(data, shift_layout);
   }
 
   // making this specifically typed would require unpacking the layout,
   // this is easier to maintain
   template <typename... Args>
-  RAJA_HOST_DEVICE RAJA_INLINE value_type &operator()(Args... args) const
+  RAJA_HOST_DEVICE RAJA_INLINE typename std::enable_if<
+      detail::vector_index_args<Args...>::count == 0,
+      reference>::type
+  operator()(Args... args) const
   {
     auto idx = stripIndexType(layout(args...));
     return data[idx];
   }
+
+  // access through a VectorIndex (see vector_exec) covers all of its lanes
+  template <typename... Args>
+  RAJA_INLINE typename std::enable_if<
+      detail::vector_index_args<Args...>::count != 0,
+      VectorRef<value_type, detail::vector_index_args<Args...>::width>>::type
+  operator()(Args... args) const
+  {
+    static_assert(detail::vector_index_args<Args...>::count == 1,
+                  "A View can be indexed with one VectorIndex at a time");
+    const size_t length = detail::vector_index_min_size(args...);
+    auto idx = stripIndexType(layout(detail::vector_lane_index(args, 0)...));
+    auto stride =
+        length > 1
+            ? stripIndexType(layout(detail::vector_lane_index(args, 1)...))
+                  - idx
+            : 1;
+    return VectorRef<value_type, detail::vector_index_args<Args...>::width>(
+        detail::element_address(data, idx),
+        static_cast<Index_type>(stride),
+        length);
+  }
 };
 
+//! View whose element assignments are streaming stores, see streaming_ptr
+template <typename ValueType, typename LayoutType>
+using StreamingView = View<ValueType, LayoutType, streaming_ptr<ValueType>>;
+
 template <typename ValueType,
           typename PointerType,
           typename LayoutType,
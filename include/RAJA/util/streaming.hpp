@@ -0,0 +1,215 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining non-temporal (streaming) stores and the
+ *          streaming_ptr pointer type for write-only Views.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_streaming_HPP
+#define RAJA_util_streaming_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+//
+// x86 stores bypass the cache with movnti, which needs SSE2 and, for 8-byte
+// values, a 64-bit target.  Elsewhere, and in device code, streaming stores
+// are ordinary stores.
+//
+#if !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__) \
+    && (defined(__SSE2__) || defined(_M_X64))
+#define RAJA_STREAMING_STORES
+#include <emmintrin.h>
+#if defined(__x86_64__) || defined(_M_X64)
+#define RAJA_STREAMING_STORES_64
+#endif
+#endif
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+template <size_t Bytes>
+RAJA_HOST_DEVICE RAJA_INLINE void streaming_store_bytes(
+    void* dst,
+    const void* src,
+    std::integral_constant<size_t, Bytes>)
+{
+  memcpy(dst, src, Bytes);
+}
+
+#if defined(RAJA_STREAMING_STORES)
+RAJA_INLINE void streaming_store_bytes(void* dst,
+                                       const void* src,
+                                       std::integral_constant<size_t, 4>)
+{
+  int bits;
+  memcpy(&bits, src, sizeof(bits));
+  _mm_stream_si32(static_cast<int*>(dst), bits);
+}
+#endif
+
+#if defined(RAJA_STREAMING_STORES_64)
+RAJA_INLINE void streaming_store_bytes(void* dst,
+                                       const void* src,
+                                       std::integral_constant<size_t, 8>)
+{
+  long long bits;
+  memcpy(&bits, src, sizeof(bits));
+  _mm_stream_si64(static_cast<long long*>(dst), bits);
+}
+#endif
+
+}  // namespace detail
+
+/*!
+ * \brief Store value to *dst without bringing the line into the cache.
+ *
+ * Values of 4 and 8 bytes use non-temporal stores where the target has
+ * them; other types are stored normally.  The store is weakly ordered: call
+ * streaming_fence() before other threads read dst.
+ */
+template <typename T>
+RAJA_HOST_DEVICE RAJA_INLINE void streaming_store(T* dst, const T& value)
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "streaming_store needs a trivially copyable type");
+  detail::streaming_store_bytes(dst,
+                                &value,
+                                std::integral_constant<size_t, sizeof(T)>{});
+}
+
+//! Order preceding streaming stores before all later stores of this thread
+RAJA_HOST_DEVICE RAJA_INLINE void streaming_fence()
+{
+#if defined(RAJA_STREAMING_STORES)
+  _mm_sfence();
+#elif !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__)
+  std::atomic_thread_fence(std::memory_order_release);
+#endif
+}
+
+/*!
+ * \brief Element reference returned by streaming_ptr; assignment is a
+ *        streaming store and reading is an ordinary load.
+ */
+template <typename T>
+class streaming_ref
+{
+public:
+  using value_type = typename std::remove_const<T>::type;
+
+  RAJA_HOST_DEVICE constexpr explicit streaming_ref(T* ptr) : m_ptr(ptr) {}
+
+  RAJA_HOST_DEVICE RAJA_INLINE operator value_type() const { return *m_ptr; }
+
+  RAJA_HOST_DEVICE RAJA_INLINE const streaming_ref& operator=(
+      const value_type& value) const
+  {
+    streaming_store(m_ptr, value);
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE const streaming_ref& operator=(
+      const streaming_ref& other) const
+  {
+    return *this = static_cast<value_type>(other);
+  }
+
+private:
+  T* m_ptr;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Pointer whose element assignments are streaming stores.
+ *
+ *         Used as the PointerType of a View that is written and not read
+ *         again soon, such as the output of a triad loop: the stores skip
+ *         the read-for-ownership and leave the cache to the inputs.  Loop
+ *         with streaming_exec, which issues the fences that make the data
+ *         visible to other threads when the loop ends.  Reading through the
+ *         View works but misses the cache, since streamed lines are evicted.
+ *
+ * Usage example:
+ *
+ * \verbatim
+ *
+ *   RAJA::StreamingView<double, RAJA::Layout<1>> a(a_ptr, N);
+ *   RAJA::forall<RAJA::streaming_exec<RAJA::omp_parallel_for_exec>>(
+ *       RAJA::RangeSegment(0, N), [=](int i) { a(i) = b[i] + s * c[i]; });
+ *
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class streaming_ptr
+{
+public:
+  using element_type = T;
+
+  streaming_ptr() = default;
+
+  RAJA_HOST_DEVICE constexpr streaming_ptr(T* ptr) : m_ptr(ptr) {}
+
+  RAJA_HOST_DEVICE constexpr T* get() const { return m_ptr; }
+
+  template <typename IdxT>
+  RAJA_HOST_DEVICE RAJA_INLINE streaming_ref<T> operator[](IdxT i) const
+  {
+    return streaming_ref<T>(m_ptr + i);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE streaming_ref<T> operator*() const
+  {
+    return streaming_ref<T>(m_ptr);
+  }
+
+private:
+  T* m_ptr = nullptr;
+};
+
+namespace detail
+{
+
+//! Raw address of element i of p, which is a pointer or pointer-like type
+template <typename PointerType, typename IdxT>
+RAJA_HOST_DEVICE RAJA_INLINE auto element_address(const PointerType& p, IdxT i)
+    -> decltype(&p[i])
+{
+  return &p[i];
+}
+
+template <typename T, typename IdxT>
+RAJA_HOST_DEVICE RAJA_INLINE T* element_address(const streaming_ptr<T>& p,
+                                                IdxT i)
+{
+  return p.get() + i;
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,164 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for the registry of autotuned loops.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/policy/AutotunePolicy.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+
+namespace RAJA
+{
+namespace policy
+{
+namespace autotune
+{
+
+namespace
+{
+
+//! First line of files written by AutotuneRegistry::save
+const char* const s_file_header = "# RAJA autotune 1";
+
+}  // namespace
+
+void AutotuneEntry::reset(int num_policies)
+{
+  choice.store(-1, std::memory_order_relaxed);
+  num_candidates.store(num_policies, std::memory_order_relaxed);
+  num_trials = 0;
+  calls.assign(num_policies, 0);
+  iterations.assign(num_policies, 0);
+  seconds.assign(num_policies, 0.0);
+}
+
+AutotuneRegistry& AutotuneRegistry::getInstance()
+{
+  static AutotuneRegistry registry;
+  return registry;
+}
+
+AutotuneSite& AutotuneRegistry::getSite(const std::string& name)
+{
+  std::lock_guard<std::mutex> guard(m_lock);
+  std::unique_ptr<AutotuneSite>& site = m_sites[name];
+  if (!site) site.reset(new AutotuneSite(name));
+  return *site;
+}
+
+void AutotuneRegistry::save(const std::string& filename) const
+{
+  std::ofstream out(filename);
+  if (!out) {
+    throw std::runtime_error("cannot write autotune file " + filename);
+  }
+
+  // one line per decision: bucket, choice, number of candidates, name
+  out << s_file_header << '\n';
+  for (const AutotuneStatistics& stats : statistics()) {
+    if (stats.choice < 0) continue;
+    out << stats.bucket << ' ' << stats.choice << ' ' << stats.calls.size()
+        << ' ' << stats.name << '\n';
+  }
+
+  if (!out) {
+    throw std::runtime_error("cannot write autotune file " + filename);
+  }
+}
+
+void AutotuneRegistry::load(const std::string& filename)
+{
+  std::ifstream in(filename);
+  std::string line;
+  if (!in || !std::getline(in, line) || line != s_file_header) {
+    throw std::runtime_error("cannot read autotune file " + filename);
+  }
+
+  while (std::getline(in, line)) {
+    std::istringstream fields(line);
+    int bucket, choice, num_policies;
+    std::string name;
+    if (!(fields >> bucket >> choice >> num_policies) || bucket < 0
+        || bucket >= num_size_buckets || choice < 0 || choice >= num_policies
+        || !std::getline(fields >> std::ws, name)) {
+      throw std::runtime_error("malformed line in autotune file " + filename
+                               + ": " + line);
+    }
+
+    AutotuneSite& site = getSite(name);
+    std::lock_guard<std::mutex> guard(site.lock);
+    AutotuneEntry& entry = site.buckets[bucket];
+    entry.reset(num_policies);
+    entry.choice.store(choice, std::memory_order_release);
+  }
+}
+
+void AutotuneRegistry::reset()
+{
+  std::lock_guard<std::mutex> guard(m_lock);
+  for (auto& named_site : m_sites) {
+    AutotuneSite& site = *named_site.second;
+    std::lock_guard<std::mutex> site_guard(site.lock);
+    for (AutotuneEntry& entry : site.buckets) {
+      entry.reset(0);
+    }
+  }
+}
+
+std::vector<AutotuneStatistics> AutotuneRegistry::statistics() const
+{
+  std::vector<AutotuneStatistics> result;
+
+  std::lock_guard<std::mutex> guard(m_lock);
+  for (const auto& named_site : m_sites) {
+    AutotuneSite& site = *named_site.second;
+    std::lock_guard<std::mutex> site_guard(site.lock);
+    for (int b = 0; b < num_size_buckets; ++b) {
+      const AutotuneEntry& entry = site.buckets[b];
+      if (entry.num_candidates == 0) continue;
+      result.push_back(AutotuneStatistics{site.name,
+                                          b,
+                                          entry.choice.load(),
+                                          entry.calls,
+                                          entry.iterations,
+                                          entry.seconds});
+    }
+  }
+
+  return result;
+}
+
+void AutotuneRegistry::print(std::ostream& os) const
+{
+  os << "loop, size bucket, choice, [policy: calls, seconds per iteration]\n";
+  for (const AutotuneStatistics& stats : statistics()) {
+    os << stats.name << ", " << stats.bucket << ", " << stats.choice << ",";
+    for (size_t p = 0; p < stats.calls.size(); ++p) {
+      os << " [" << p << ": " << stats.calls[p] << ", "
+         << std::setprecision(3)
+         << (stats.iterations[p] > 0 ? stats.seconds[p] / stats.iterations[p]
+                                     : stats.seconds[p])
+         << "]";
+    }
+    os << '\n';
+  }
+}
+
+}  // namespace autotune
+}  // namespace policy
+}  // namespace RAJA
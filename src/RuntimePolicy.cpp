@@ -0,0 +1,210 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for the run-time selection of runtime_exec
+ *          policies.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/policy/RuntimePolicy.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+
+namespace RAJA
+{
+
+namespace
+{
+
+const char* const s_policy_names[] = {"seq_exec",
+                                      "loop_exec",
+                                      "simd_exec",
+                                      "omp_parallel_for_exec",
+                                      "tbb_for_dynamic",
+                                      "threads_for_dynamic"};
+
+constexpr int s_num_policies =
+    sizeof(s_policy_names) / sizeof(s_policy_names[0]);
+
+//! Slots of all named loops; the default policy is the slot of ""
+class RuntimeSlots
+{
+public:
+  static RuntimeSlots& getInstance()
+  {
+    static RuntimeSlots slots;
+    return slots;
+  }
+
+  policy::runtime::runtime_slot& get(const std::string& loop_name)
+  {
+    std::lock_guard<std::mutex> guard(m_lock);
+    std::unique_ptr<policy::runtime::runtime_slot>& slot = m_slots[loop_name];
+    if (!slot) slot.reset(new policy::runtime::runtime_slot(-1));
+    return *slot;
+  }
+
+private:
+  RuntimeSlots()
+  {
+    m_slots[""].reset(new policy::runtime::runtime_slot(
+        static_cast<int>(RuntimePolicy::seq_exec)));
+  }
+
+  std::mutex m_lock;
+  std::map<std::string, std::unique_ptr<policy::runtime::runtime_slot>>
+      m_slots;
+};
+
+void checkAvailable(RuntimePolicy p)
+{
+  if (!runtime_policy_available(p)) {
+    throw std::runtime_error("RAJA runtime policy " + to_string(p)
+                             + " is not enabled in this build");
+  }
+}
+
+void storePolicy(const std::string& loop_name, RuntimePolicy p)
+{
+  checkAvailable(p);
+  RuntimeSlots::getInstance().get(loop_name).store(static_cast<int>(p),
+                                                   std::memory_order_relaxed);
+}
+
+void readConfig(const std::string& filename)
+{
+  std::ifstream in(filename);
+  if (!in) {
+    throw std::runtime_error("cannot read RAJA runtime policy file "
+                             + filename);
+  }
+
+  std::string line;
+  while (std::getline(in, line)) {
+    std::istringstream fields(line);
+    std::string loop_name, policy_name, extra;
+    if (!(fields >> loop_name) || loop_name[0] == '#') continue;
+    if (!(fields >> policy_name) || (fields >> extra)) {
+      throw std::runtime_error("malformed line in RAJA runtime policy file "
+                               + filename + ": " + line);
+    }
+    storePolicy(loop_name == "default" ? std::string() : loop_name,
+                runtime_policy_from_string(policy_name));
+  }
+}
+
+//! Apply RAJA_RUNTIME_POLICY_FILE and RAJA_RUNTIME_POLICY before first use
+void loadEnvironment()
+{
+  static std::once_flag environment_loaded;
+  std::call_once(environment_loaded, []() {
+    if (const char* file = std::getenv("RAJA_RUNTIME_POLICY_FILE")) {
+      readConfig(file);
+    }
+    if (const char* name = std::getenv("RAJA_RUNTIME_POLICY")) {
+      storePolicy("", runtime_policy_from_string(name));
+    }
+  });
+}
+
+policy::runtime::runtime_slot& getSlot(const std::string& loop_name)
+{
+  loadEnvironment();
+  return RuntimeSlots::getInstance().get(loop_name);
+}
+
+}  // namespace
+
+bool runtime_policy_available(RuntimePolicy p)
+{
+  switch (p) {
+    case RuntimePolicy::seq_exec:
+    case RuntimePolicy::loop_exec:
+    case RuntimePolicy::simd_exec:
+      return true;
+#if defined(RAJA_ENABLE_OPENMP)
+    case RuntimePolicy::omp_parallel_for_exec:
+      return true;
+#endif
+#if defined(RAJA_ENABLE_TBB)
+    case RuntimePolicy::tbb_for_dynamic:
+      return true;
+#endif
+#if defined(RAJA_ENABLE_THREADS)
+    case RuntimePolicy::threads_for_dynamic:
+      return true;
+#endif
+    default:
+      return false;
+  }
+}
+
+std::string to_string(RuntimePolicy p)
+{
+  const int index = static_cast<int>(p);
+  if (index < 0 || index >= s_num_policies) {
+    throw std::runtime_error("unknown RAJA runtime policy");
+  }
+  return s_policy_names[index];
+}
+
+RuntimePolicy runtime_policy_from_string(const std::string& name)
+{
+  for (int p = 0; p < s_num_policies; ++p) {
+    if (name == s_policy_names[p]) return static_cast<RuntimePolicy>(p);
+  }
+  throw std::runtime_error("unknown RAJA runtime policy " + name);
+}
+
+void set_runtime_policy(RuntimePolicy p) { set_runtime_policy("", p); }
+
+void set_runtime_policy(const std::string& loop_name, RuntimePolicy p)
+{
+  // the environment is applied first, so it cannot override this call
+  loadEnvironment();
+  storePolicy(loop_name, p);
+}
+
+RuntimePolicy get_runtime_policy(const std::string& loop_name)
+{
+  int p = getSlot(loop_name).load(std::memory_order_relaxed);
+  if (p < 0) p = getSlot("").load(std::memory_order_relaxed);
+  return static_cast<RuntimePolicy>(p);
+}
+
+void load_runtime_policy_config(const std::string& filename)
+{
+  loadEnvironment();
+  readConfig(filename);
+}
+
+namespace policy
+{
+namespace runtime
+{
+
+const runtime_slot* getRuntimeSlot(const std::string& loop_name)
+{
+  return &getSlot(loop_name);
+}
+
+}  // namespace runtime
+}  // namespace policy
+
+}  // namespace RAJA
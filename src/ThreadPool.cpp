@@ -0,0 +1,250 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for the persistent work-stealing thread pool.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "RAJA/policy/threads/ThreadPool.hpp"
+
+namespace RAJA
+{
+namespace threads
+{
+
+namespace
+{
+
+//! Pool slot of the calling thread; 0 for threads outside the pool.
+thread_local int t_thread_num = 0;
+
+//! Polls of the pending-work counter an idle worker makes before sleeping.
+constexpr int s_spin_count = 4096;
+
+int defaultNumThreads()
+{
+  if (const char* env = std::getenv("RAJA_NUM_THREADS")) {
+    const int num_threads = std::atoi(env);
+    if (num_threads > 0) return num_threads;
+  }
+  const unsigned hw_threads = std::thread::hardware_concurrency();
+  return hw_threads > 0 ? static_cast<int>(hw_threads) : 1;
+}
+
+}  // namespace
+
+ThreadPool& ThreadPool::getInstance()
+{
+  static ThreadPool pool;
+  return pool;
+}
+
+ThreadPool::ThreadPool() : m_pending(0), m_sleeping(0), m_stop(false)
+{
+  start(defaultNumThreads());
+}
+
+ThreadPool::~ThreadPool() { stop(); }
+
+int ThreadPool::getThreadNum() { return t_thread_num; }
+
+void ThreadPool::resize(int num_threads)
+{
+  if (num_threads < 1) num_threads = 1;
+  if (num_threads == getNumThreads()) return;
+  stop();
+  start(num_threads);
+}
+
+void ThreadPool::start(int num_threads)
+{
+  m_stop.store(false);
+  m_pending.store(0);
+
+  m_queues.clear();
+  for (int i = 0; i < num_threads; ++i) {
+    m_queues.emplace_back(new WorkQueue);
+  }
+
+  m_workers.reserve(num_threads - 1);
+  for (int id = 1; id < num_threads; ++id) {
+    m_workers.emplace_back(&ThreadPool::workerLoop, this, id);
+  }
+}
+
+void ThreadPool::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_sleep_lock);
+    m_stop.store(true);
+  }
+  m_wakeup.notify_all();
+
+  for (auto& worker : m_workers) {
+    worker.join();
+  }
+  m_workers.clear();
+}
+
+void ThreadPool::launch(Task const& task)
+{
+  const int id = t_thread_num;
+  const Index_type n = task.end - task.begin;
+
+  if (id == 0 && n > task.grain) {
+    // deal contiguous blocks out to every thread, none smaller than grain
+    const Index_type num_blocks =
+        std::min(static_cast<Index_type>(getNumThreads()),
+                 (n + task.grain - 1) / task.grain);
+    for (Index_type b = num_blocks - 1; b >= 0; --b) {
+      Task block = task;
+      block.begin = task.begin + (n * b) / num_blocks;
+      block.end = task.begin + (n * (b + 1)) / num_blocks;
+      push(static_cast<int>(b), block);
+    }
+  } else {
+    push(id, task);
+  }
+
+  notify();
+}
+
+void ThreadPool::wait(TaskGroup& group)
+{
+  const int id = t_thread_num;
+  Task task;
+  while (!group.done()) {
+    if (pop(id, task) || steal(id, task)) {
+      execute(id, task);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+void ThreadPool::workerLoop(int id)
+{
+  t_thread_num = id;
+
+  Task task;
+  while (!m_stop.load(std::memory_order_acquire)) {
+    if (pop(id, task) || steal(id, task)) {
+      execute(id, task);
+      continue;
+    }
+
+    bool has_work = false;
+    for (int spin = 0; spin < s_spin_count && !has_work; ++spin) {
+      has_work = m_pending.load(std::memory_order_relaxed) > 0
+                 || m_stop.load(std::memory_order_relaxed);
+      if (!has_work) std::this_thread::yield();
+    }
+    if (has_work) continue;
+
+    // m_sleeping is raised before m_pending is checked under the lock, and
+    // notify() reads m_sleeping after raising m_pending, so a launch can
+    // never slip between the check and the wait unnoticed.
+    std::unique_lock<std::mutex> lock(m_sleep_lock);
+    m_sleeping.fetch_add(1);
+    m_wakeup.wait(lock, [this] {
+      return m_stop.load() || m_pending.load() > 0;
+    });
+    m_sleeping.fetch_sub(1);
+  }
+
+  t_thread_num = 0;
+}
+
+void ThreadPool::push(int id, Task const& task)
+{
+  WorkQueue& queue = *m_queues[id];
+  {
+    std::lock_guard<std::mutex> lock(queue.lock);
+    queue.tasks.push_back(task);
+  }
+  m_pending.fetch_add(1);
+}
+
+bool ThreadPool::pop(int id, Task& task)
+{
+  WorkQueue& queue = *m_queues[id];
+  std::lock_guard<std::mutex> lock(queue.lock);
+  if (queue.tasks.empty()) return false;
+  task = queue.tasks.back();
+  queue.tasks.pop_back();
+  m_pending.fetch_sub(1);
+  return true;
+}
+
+bool ThreadPool::steal(int id, Task& task)
+{
+  if (m_pending.load(std::memory_order_relaxed) <= 0) return false;
+
+  const int num_queues = getNumThreads();
+  for (int k = 1; k < num_queues; ++k) {
+    WorkQueue& queue = *m_queues[(id + k) % num_queues];
+    std::unique_lock<std::mutex> lock(queue.lock, std::try_to_lock);
+    if (!lock.owns_lock() || queue.tasks.empty()) continue;
+    // the front holds the oldest, and therefore largest, piece
+    task = queue.tasks.front();
+    queue.tasks.pop_front();
+    m_pending.fetch_sub(1);
+    return true;
+  }
+  return false;
+}
+
+void ThreadPool::execute(int id, Task task)
+{
+  bool split = false;
+  while (task.end - task.begin > task.grain) {
+    const Index_type mid = task.begin + (task.end - task.begin) / 2;
+    Task upper = task;
+    upper.begin = mid;
+    push(id, upper);
+    task.end = mid;
+    split = true;
+  }
+  if (split) notify();
+
+  const Index_type work = task.end - task.begin;
+  TaskGroup* group = task.group;
+  if (!group->failed()) {
+    try {
+      task.fn(task.data, task.begin, task.end);
+    } catch (...) {
+      group->fail(std::current_exception());
+    }
+  }
+  group->complete(work);
+}
+
+void ThreadPool::notify()
+{
+  if (m_sleeping.load() > 0) {
+    std::lock_guard<std::mutex> lock(m_sleep_lock);
+    m_wakeup.notify_all();
+  }
+}
+
+}  // namespace threads
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
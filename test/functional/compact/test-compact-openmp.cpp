@@ -0,0 +1,20 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "test-compact.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+using OpenMPCompactTypes = 
+  Test<camp::cartesian_product< OpenMPForallExecPols,
+                                CompactDataTypes >>::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(OpenMP, 
+                               CompactFunctionalTest, 
+                               OpenMPCompactTypes);
+
+#endif
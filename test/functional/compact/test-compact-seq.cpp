@@ -0,0 +1,16 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "test-compact.hpp"
+
+using SequentialCompactTypes = 
+  Test<camp::cartesian_product< SequentialForallExecPols,
+                                CompactDataTypes >>::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(Sequential, 
+                               CompactFunctionalTest, 
+                               SequentialCompactTypes);
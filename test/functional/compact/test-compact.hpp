@@ -0,0 +1,36 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_COMPACT_HPP__
+#define __TEST_COMPACT_HPP__
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_test-camp.hpp"
+
+#include "RAJA_test-forall-execpol.hpp"
+
+// Compaction functional test class
+template<typename T>
+class CompactFunctionalTest: public ::testing::Test {};
+
+// Define compaction data types
+using CompactDataTypes = camp::list< int,
+                                     long,
+                                     double >;
+
+TYPED_TEST_SUITE_P(CompactFunctionalTest);
+
+#include "tests/test-compact.hpp"
+
+REGISTER_TYPED_TEST_SUITE_P(CompactFunctionalTest,
+                            CopyIf,
+                            RemoveIf,
+                            Partition,
+                            Unique,
+                            ListSegmentIf);
+
+#endif //__TEST_COMPACT_HPP__
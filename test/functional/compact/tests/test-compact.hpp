@@ -0,0 +1,205 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_COMPACT_TESTS_HPP__
+#define __TEST_COMPACT_TESTS_HPP__
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <vector>
+
+// values in [low, low + range) so that there are runs of equal values
+template <typename T>
+std::vector<T> makeCompactData(int N, int range, int low = 0)
+{
+  std::mt19937 gen(N + range);
+  std::vector<T> data(N);
+  for (int i = 0; i < N; ++i) {
+    data[i] = static_cast<T>(low + static_cast<int>(gen() % range));
+  }
+  return data;
+}
+
+template <typename T>
+struct CompactIsSmall {
+  bool operator()(const T& v) const { return v < static_cast<T>(3); }
+};
+
+template <typename EXEC_POLICY, typename T>
+void CopyIfFunctionalTestImpl(int N)
+{
+  const std::vector<T> in = makeCompactData<T>(N, 10);
+  std::vector<T> out(N);
+
+  std::vector<T> ref;
+  std::copy_if(
+      in.begin(), in.end(), std::back_inserter(ref), CompactIsSmall<T>{});
+
+  RAJA::Index_type count = RAJA::copy_if<EXEC_POLICY>(
+      in.begin(), in.end(), out.begin(), CompactIsSmall<T>{});
+
+  ASSERT_EQ(static_cast<RAJA::Index_type>(ref.size()), count);
+  for (RAJA::Index_type i = 0; i < count; ++i) {
+    ASSERT_EQ(ref[i], out[i]) << "(at index " << i << ")";
+  }
+
+  std::vector<T> out_true(N), out_false(N);
+  std::vector<T> ref_false;
+  std::remove_copy_if(in.begin(), in.end(), std::back_inserter(ref_false),
+                      CompactIsSmall<T>{});
+
+  count = RAJA::partition_copy<EXEC_POLICY>(in.data(),
+                                            in.data() + N,
+                                            out_true.data(),
+                                            out_false.data(),
+                                            CompactIsSmall<T>{});
+
+  ASSERT_EQ(static_cast<RAJA::Index_type>(ref.size()), count);
+  for (RAJA::Index_type i = 0; i < count; ++i) {
+    ASSERT_EQ(ref[i], out_true[i]) << "(at index " << i << ")";
+  }
+  for (size_t i = 0; i < ref_false.size(); ++i) {
+    ASSERT_EQ(ref_false[i], out_false[i]) << "(at index " << i << ")";
+  }
+}
+
+template <typename EXEC_POLICY, typename T>
+void RemoveIfFunctionalTestImpl(int N, int range = 10, int low = 0)
+{
+  std::vector<T> data = makeCompactData<T>(N, range, low);
+  std::vector<T> ref = data;
+  ref.erase(std::remove_if(ref.begin(), ref.end(), CompactIsSmall<T>{}),
+            ref.end());
+
+  RAJA::Index_type count =
+      RAJA::remove_if<EXEC_POLICY>(data, CompactIsSmall<T>{});
+
+  ASSERT_EQ(static_cast<RAJA::Index_type>(ref.size()), count);
+  for (RAJA::Index_type i = 0; i < count; ++i) {
+    ASSERT_EQ(ref[i], data[i]) << "(at index " << i << ")";
+  }
+}
+
+template <typename EXEC_POLICY, typename T>
+void PartitionFunctionalTestImpl(int N, int range = 10, int low = 0)
+{
+  std::vector<T> data = makeCompactData<T>(N, range, low);
+  std::vector<T> ref = data;
+  const RAJA::Index_type ref_count =
+      std::stable_partition(ref.begin(), ref.end(), CompactIsSmall<T>{}) -
+      ref.begin();
+
+  RAJA::Index_type count = RAJA::partition<EXEC_POLICY>(
+      data.begin(), data.end(), CompactIsSmall<T>{});
+
+  ASSERT_EQ(ref_count, count);
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(ref[i], data[i]) << "(at index " << i << ")";
+  }
+}
+
+template <typename EXEC_POLICY, typename T>
+void UniqueFunctionalTestImpl(int N)
+{
+  std::vector<T> data = makeCompactData<T>(N, 3);
+  std::vector<T> ref = data;
+  ref.erase(std::unique(ref.begin(), ref.end()), ref.end());
+
+  std::vector<T> out(N);
+  RAJA::Index_type count =
+      RAJA::unique_copy<EXEC_POLICY>(data.begin(), data.end(), out.begin());
+
+  ASSERT_EQ(static_cast<RAJA::Index_type>(ref.size()), count);
+  for (RAJA::Index_type i = 0; i < count; ++i) {
+    ASSERT_EQ(ref[i], out[i]) << "(at index " << i << ")";
+  }
+
+  count = RAJA::unique<EXEC_POLICY>(data);
+
+  ASSERT_EQ(static_cast<RAJA::Index_type>(ref.size()), count);
+  for (RAJA::Index_type i = 0; i < count; ++i) {
+    ASSERT_EQ(ref[i], data[i]) << "(at index " << i << ")";
+  }
+}
+
+template <typename EXEC_POLICY>
+void ListSegmentIfFunctionalTestImpl(int N)
+{
+  RAJA::TypedRangeSegment<RAJA::Index_type> range(0, N);
+
+  RAJA::ListSegment seg = RAJA::make_list_segment_if<EXEC_POLICY>(
+      range.begin(), range.end(), [](RAJA::Index_type i) {
+        return i % 3 == 1;
+      });
+
+  ASSERT_EQ((N + 1) / 3, seg.size());
+  RAJA::Index_type expected = 1;
+  for (auto i : seg) {
+    ASSERT_EQ(expected, i);
+    expected += 3;
+  }
+}
+
+TYPED_TEST_P(CompactFunctionalTest, CopyIf)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using DATA_TYPE   = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  CopyIfFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(0);
+  CopyIfFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(357);
+  CopyIfFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(32000);
+}
+
+TYPED_TEST_P(CompactFunctionalTest, RemoveIf)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using DATA_TYPE   = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  RemoveIfFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(0);
+  RemoveIfFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(357);
+  RemoveIfFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(32000);
+
+  // every element removed, and none
+  RemoveIfFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(357, 3);
+  RemoveIfFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(357, 10, 3);
+}
+
+TYPED_TEST_P(CompactFunctionalTest, Partition)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using DATA_TYPE   = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  PartitionFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(0);
+  PartitionFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(357);
+  PartitionFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(32000);
+
+  // predicate true for every element, and for none
+  PartitionFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(357, 3);
+  PartitionFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(357, 10, 3);
+}
+
+TYPED_TEST_P(CompactFunctionalTest, Unique)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using DATA_TYPE   = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  UniqueFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(0);
+  UniqueFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(357);
+  UniqueFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(32000);
+}
+
+TYPED_TEST_P(CompactFunctionalTest, ListSegmentIf)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+
+  ListSegmentIfFunctionalTestImpl<EXEC_POLICY>(0);
+  ListSegmentIfFunctionalTestImpl<EXEC_POLICY>(357);
+  ListSegmentIfFunctionalTestImpl<EXEC_POLICY>(32000);
+}
+
+#endif // __TEST_COMPACT_TESTS_HPP__
@@ -0,0 +1,49 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "test-forall-async.hpp"
+
+#include <atomic>
+#include <chrono>
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+// Cartesian product of types for OpenMP tests
+using OpenMPForallAsyncTypes =
+  Test< camp::cartesian_product<IdxTypeList,
+                                HostResourceList,
+                                OpenMPForallExecPols> >::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(OpenMP,
+                               ForallAsyncTest,
+                               OpenMPForallAsyncTypes);
+
+// the loop runs while the launching thread goes on, with or without the
+// threads back-end pool
+TEST(ForallAsyncOpenMPTest, Overlap)
+{
+  std::atomic<bool> go{false};
+  std::atomic<int> released{0};
+  std::atomic<bool>* go_ptr = &go;
+  std::atomic<int>* released_ptr = &released;
+
+  RAJA::AsyncEvent event = RAJA::forall_async<RAJA::omp_parallel_for_exec>(
+      RAJA::RangeSegment(0, 4), [=](int) {
+        const auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (!go_ptr->load() && std::chrono::steady_clock::now() < deadline) {
+        }
+        if (go_ptr->load()) released_ptr->fetch_add(1);
+      });
+
+  go = true;
+  event.wait();
+
+  ASSERT_EQ(released.load(), 4);
+}
+
+#endif
@@ -0,0 +1,18 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "test-forall-async.hpp"
+
+// Cartesian product of types for Sequential tests
+using SequentialForallAsyncTypes =
+  Test< camp::cartesian_product<IdxTypeList,
+                                HostResourceList,
+                                SequentialForallExecPols> >::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(Sequential,
+                               ForallAsyncTest,
+                               SequentialForallAsyncTypes);
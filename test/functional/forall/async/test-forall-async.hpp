@@ -0,0 +1,29 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_ASYNC_HPP__
+#define __TEST_FORALL_ASYNC_HPP__
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_test-camp.hpp"
+#include "RAJA_test-index-types.hpp"
+
+#include "RAJA_test-forall-data.hpp"
+#include "RAJA_test-forall-execpol.hpp"
+
+TYPED_TEST_SUITE_P(ForallAsyncTest);
+template <typename T>
+class ForallAsyncTest : public ::testing::Test
+{
+};
+
+#include "tests/test-forall-async-rangesegment.hpp"
+
+REGISTER_TYPED_TEST_SUITE_P(ForallAsyncTest,
+                            RangeSegmentForallAsync);
+
+#endif  // __TEST_FORALL_ASYNC_HPP__
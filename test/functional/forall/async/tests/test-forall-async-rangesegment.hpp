@@ -0,0 +1,96 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_ASYNC_RANGESEGMENT_HPP__
+#define __TEST_FORALL_ASYNC_RANGESEGMENT_HPP__
+
+#include <numeric>
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallAsyncRangeSegmentTest(INDEX_TYPE first, INDEX_TYPE last)
+{
+  RAJA::TypedRangeSegment<INDEX_TYPE> r1(first, last);
+  INDEX_TYPE N = INDEX_TYPE(r1.end() - r1.begin());
+
+  camp::resources::Resource working_res{WORKING_RES()};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+  INDEX_TYPE* working_array2;
+  INDEX_TYPE* check_array2;
+  INDEX_TYPE* test_array2;
+
+  allocateForallTestData<INDEX_TYPE>(N,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  allocateForallTestData<INDEX_TYPE>(N,
+                                     working_res,
+                                     &working_array2,
+                                     &check_array2,
+                                     &test_array2);
+
+  const INDEX_TYPE rbegin = *r1.begin();
+
+  std::iota(test_array, test_array + N, rbegin);
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; i++) {
+    test_array2[i] = INDEX_TYPE(2) * test_array[i];
+  }
+
+  // two independent loops in flight at once
+  RAJA::AsyncEvent e1 = RAJA::forall_async<EXEC_POLICY>(r1, [=](INDEX_TYPE idx) {
+    working_array[idx - rbegin] = idx;
+  });
+
+  RAJA::AsyncEvent e2 = RAJA::forall_async<EXEC_POLICY>(r1, [=](INDEX_TYPE idx) {
+    working_array2[idx - rbegin] = INDEX_TYPE(2) * idx;
+  });
+
+  e2.wait();
+  e1.wait();
+
+  ASSERT_TRUE(e1.test());
+  ASSERT_TRUE(e2.test());
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * N);
+  working_res.memcpy(check_array2, working_array2, sizeof(INDEX_TYPE) * N);
+
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; i++) {
+    ASSERT_EQ(test_array[i], check_array[i]);
+    ASSERT_EQ(test_array2[i], check_array2[i]);
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array2,
+                                       check_array2,
+                                       test_array2);
+}
+
+TYPED_TEST_P(ForallAsyncTest, RangeSegmentForallAsync)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ForallAsyncRangeSegmentTest<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(0), INDEX_TYPE(5));
+  ForallAsyncRangeSegmentTest<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(1), INDEX_TYPE(255));
+  ForallAsyncRangeSegmentTest<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(0), INDEX_TYPE(10000));
+
+  // a default constructed event is complete
+  RAJA::AsyncEvent e;
+  ASSERT_TRUE(e.test());
+  e.wait();
+}
+
+#endif  // __TEST_FORALL_ASYNC_RANGESEGMENT_HPP__
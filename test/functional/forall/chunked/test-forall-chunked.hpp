@@ -0,0 +1,30 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_CHUNKED_HPP__
+#define __TEST_FORALL_CHUNKED_HPP__
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_test-camp.hpp"
+#include "RAJA_test-index-types.hpp"
+
+#include "RAJA_test-forall-data.hpp"
+#include "RAJA_test-forall-execpol.hpp"
+#include "RAJA_test-reducepol.hpp"
+
+TYPED_TEST_SUITE_P(ForallChunkedTest);
+template <typename T>
+class ForallChunkedTest : public ::testing::Test
+{
+};
+
+#include "tests/test-forall-chunked-rangesegment.hpp"
+
+REGISTER_TYPED_TEST_SUITE_P(ForallChunkedTest,
+                            RangeSegmentForallChunked);
+
+#endif  // __TEST_FORALL_CHUNKED_HPP__
@@ -0,0 +1,94 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_CHUNKED_RANGESEGMENT_HPP__
+#define __TEST_FORALL_CHUNKED_RANGESEGMENT_HPP__
+
+#include <numeric>
+
+template <typename INDEX_TYPE,
+          typename WORKING_RES,
+          typename EXEC_POLICY,
+          typename REDUCE_POLICY>
+void ForallChunkedRangeSegmentTest(INDEX_TYPE first, INDEX_TYPE last)
+{
+  using segment_type = RAJA::TypedRangeSegment<INDEX_TYPE>;
+
+  segment_type r1(first, last);
+  INDEX_TYPE N = INDEX_TYPE(r1.end() - r1.begin());
+
+  camp::resources::Resource working_res{WORKING_RES()};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  allocateForallTestData<INDEX_TYPE>(N,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  const INDEX_TYPE rbegin = *r1.begin();
+
+  std::iota(test_array, test_array + N, rbegin);
+
+  long long ref_sum = 0;
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; i++) {
+    ref_sum += test_array[i];
+  }
+
+  working_res.memset(working_array, 0, sizeof(INDEX_TYPE) * N);
+
+  RAJA::ReduceSum<REDUCE_POLICY, long long> sum(0);
+  RAJA::ReduceSum<REDUCE_POLICY, int> num_chunks(0);
+  RAJA::ReduceMin<REDUCE_POLICY, int> empty_chunks(1);
+
+  // every index is in exactly one chunk, so each entry is written once
+  RAJA::forall_chunked<EXEC_POLICY>(r1, [=](segment_type chunk) {
+    long long local_sum = 0;
+    for (auto idx : chunk) {
+      working_array[idx - rbegin] += idx;
+      local_sum += static_cast<long long>(idx);
+    }
+    sum += local_sum;
+    num_chunks += 1;
+    empty_chunks.min(chunk.size() > 0 ? 1 : 0);
+  });
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * N);
+
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; i++) {
+    ASSERT_EQ(test_array[i], check_array[i]);
+  }
+
+  ASSERT_EQ(ref_sum, sum.get());
+  ASSERT_EQ(1, empty_chunks.get());
+  ASSERT_LE(num_chunks.get(), static_cast<int>(N));
+  if (N > 0) {
+    ASSERT_GE(num_chunks.get(), 1);
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+TYPED_TEST_P(ForallChunkedTest, RangeSegmentForallChunked)
+{
+  using INDEX_TYPE    = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES   = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY   = typename camp::at<TypeParam, camp::num<2>>::type;
+  using REDUCE_POLICY = typename camp::at<TypeParam, camp::num<3>>::type;
+
+  ForallChunkedRangeSegmentTest<INDEX_TYPE, WORKING_RES, EXEC_POLICY, REDUCE_POLICY>(INDEX_TYPE(0), INDEX_TYPE(5));
+  ForallChunkedRangeSegmentTest<INDEX_TYPE, WORKING_RES, EXEC_POLICY, REDUCE_POLICY>(INDEX_TYPE(1), INDEX_TYPE(255));
+  ForallChunkedRangeSegmentTest<INDEX_TYPE, WORKING_RES, EXEC_POLICY, REDUCE_POLICY>(INDEX_TYPE(0), INDEX_TYPE(10000));
+  ForallChunkedRangeSegmentTest<INDEX_TYPE, WORKING_RES, EXEC_POLICY, REDUCE_POLICY>(INDEX_TYPE(3), INDEX_TYPE(3));
+}
+
+#endif  // __TEST_FORALL_CHUNKED_RANGESEGMENT_HPP__
@@ -0,0 +1,23 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "test-forall-fused.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+// Cartesian product of types for OpenMP tests
+using OpenMPForallFusedTypes =
+  Test< camp::cartesian_product<IdxTypeList,
+                                HostResourceList,
+                                OpenMPForallExecPols,
+                                OpenMPReducePols> >::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(OpenMP,
+                               ForallFusedTest,
+                               OpenMPForallFusedTypes);
+
+#endif
@@ -0,0 +1,19 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "test-forall-fused.hpp"
+
+// Cartesian product of types for Sequential tests
+using SequentialForallFusedTypes =
+  Test< camp::cartesian_product<IdxTypeList,
+                                HostResourceList,
+                                SequentialForallExecPols,
+                                SequentialReducePols> >::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(Sequential,
+                               ForallFusedTest,
+                               SequentialForallFusedTypes);
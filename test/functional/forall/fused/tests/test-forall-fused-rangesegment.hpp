@@ -0,0 +1,97 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_FUSED_RANGESEGMENT_HPP__
+#define __TEST_FORALL_FUSED_RANGESEGMENT_HPP__
+
+#include <numeric>
+
+template <typename INDEX_TYPE,
+          typename WORKING_RES,
+          typename EXEC_POLICY,
+          typename REDUCE_POLICY>
+void ForallFusedRangeSegmentTest(INDEX_TYPE first, INDEX_TYPE last)
+{
+  RAJA::TypedRangeSegment<INDEX_TYPE> r1(first, last);
+  INDEX_TYPE N = INDEX_TYPE(r1.end() - r1.begin());
+
+  camp::resources::Resource working_res{WORKING_RES()};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  allocateForallTestData<INDEX_TYPE>(N,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  const INDEX_TYPE rbegin = *r1.begin();
+
+  std::iota(test_array, test_array + N, rbegin);
+
+  long long ref_sum = 0;
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; i++) {
+    test_array[i] = INDEX_TYPE(3) * test_array[i];
+    ref_sum += test_array[i];
+  }
+
+  RAJA::ReduceSum<REDUCE_POLICY, long long> sum(0);
+  RAJA::ReduceMax<REDUCE_POLICY, INDEX_TYPE> max(0);
+
+  // later bodies read what earlier bodies wrote at the same index
+  RAJA::forall_fused<EXEC_POLICY>(
+      r1,
+      [=](INDEX_TYPE idx) { working_array[idx - rbegin] = idx; },
+      [=](INDEX_TYPE idx) { working_array[idx - rbegin] *= INDEX_TYPE(3); },
+      [=](INDEX_TYPE idx) {
+        sum += static_cast<long long>(working_array[idx - rbegin]);
+        max.max(working_array[idx - rbegin]);
+      });
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * N);
+
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; i++) {
+    ASSERT_EQ(test_array[i], check_array[i]);
+  }
+
+  ASSERT_EQ(ref_sum, sum.get());
+  if (N > 0) {
+    ASSERT_EQ(test_array[N - 1], max.get());
+  }
+
+  // chunk size that does not divide the range
+  RAJA::forall_fused<EXEC_POLICY, 7>(
+      r1,
+      [=](INDEX_TYPE idx) { working_array[idx - rbegin] = idx; },
+      [=](INDEX_TYPE idx) { working_array[idx - rbegin] *= INDEX_TYPE(3); });
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * N);
+
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; i++) {
+    ASSERT_EQ(test_array[i], check_array[i]);
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+TYPED_TEST_P(ForallFusedTest, RangeSegmentForallFused)
+{
+  using INDEX_TYPE    = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES   = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY   = typename camp::at<TypeParam, camp::num<2>>::type;
+  using REDUCE_POLICY = typename camp::at<TypeParam, camp::num<3>>::type;
+
+  ForallFusedRangeSegmentTest<INDEX_TYPE, WORKING_RES, EXEC_POLICY, REDUCE_POLICY>(INDEX_TYPE(0), INDEX_TYPE(5));
+  ForallFusedRangeSegmentTest<INDEX_TYPE, WORKING_RES, EXEC_POLICY, REDUCE_POLICY>(INDEX_TYPE(1), INDEX_TYPE(255));
+  ForallFusedRangeSegmentTest<INDEX_TYPE, WORKING_RES, EXEC_POLICY, REDUCE_POLICY>(INDEX_TYPE(0), INDEX_TYPE(10000));
+}
+
+#endif  // __TEST_FORALL_FUSED_RANGESEGMENT_HPP__
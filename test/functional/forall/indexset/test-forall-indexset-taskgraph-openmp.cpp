@@ -0,0 +1,92 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_test-camp.hpp"
+
+#include "RAJA_test-indexset-execpol.hpp"
+
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+TYPED_TEST_SUITE_P(ForallIndexSetTaskgraphTest);
+template <typename T>
+class ForallIndexSetTaskgraphTest : public ::testing::Test
+{
+};
+
+//
+// Each segment reads the last value written by the segment before it and by
+// the segment one "row" before it, so any ordering violation changes the
+// result.  Segments in the same row are otherwise independent.
+//
+TYPED_TEST_P(ForallIndexSetTaskgraphTest, IndexSetTaskgraphForall)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using RangeSegType = RAJA::TypedRangeSegment<int>;
+
+  constexpr int seg_len = 16;
+  constexpr int row_len = 5;
+  constexpr int num_seg = 40;
+
+  RAJA::TypedIndexSet<RangeSegType> iset;
+  for (int s = 0; s < num_seg; ++s) {
+    iset.push_back(RangeSegType(s * seg_len, (s + 1) * seg_len));
+  }
+  for (int s = 0; s < num_seg; ++s) {
+    if (s % row_len != 0) iset.addSegmentDependency(s - 1, s);
+    if (s >= row_len) iset.addSegmentDependency(s - row_len, s);
+  }
+
+  std::vector<long> test_data(num_seg * seg_len, 0);
+  std::vector<long> check_data(num_seg * seg_len, 0);
+  long* test = test_data.data();
+
+  auto body = [=](int i) {
+    const int s = i / seg_len;
+    const long left = (s % row_len != 0) ? test[(s - 1) * seg_len] : 0;
+    const long up = (s >= row_len) ? test[(s - row_len) * seg_len] : 0;
+    test[i] = left + up + 1;
+  };
+
+  for (int s = 0; s < num_seg; ++s) {
+    for (int i = s * seg_len; i < (s + 1) * seg_len; ++i) {
+      const long left =
+          (s % row_len != 0) ? check_data[(s - 1) * seg_len] : 0;
+      const long up = (s >= row_len) ? check_data[(s - row_len) * seg_len] : 0;
+      check_data[i] = left + up + 1;
+    }
+  }
+
+  // run twice to check the graph is ready for reuse
+  for (int rep = 0; rep < 2; ++rep) {
+    std::fill(test_data.begin(), test_data.end(), 0);
+    RAJA::forall<EXEC_POLICY>(iset, body);
+
+    for (int i = 0; i < num_seg * seg_len; ++i) {
+      ASSERT_EQ(check_data[i], test_data[i]);
+    }
+  }
+
+  RAJA::ReduceSum<RAJA::omp_reduce, long> sum(0);
+  RAJA::forall<EXEC_POLICY>(iset, [=](int i) { sum += i; });
+  const long n = num_seg * seg_len;
+  ASSERT_EQ(n * (n - 1) / 2, sum.get());
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallIndexSetTaskgraphTest,
+                            IndexSetTaskgraphForall);
+
+using OpenMPTaskgraphIndexSetTypes =
+  Test< camp::cartesian_product<OpenMPTaskgraphIndexSetExecPols>>::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(OpenMP,
+                               ForallIndexSetTaskgraphTest,
+                               OpenMPTaskgraphIndexSetTypes);
+
+#endif
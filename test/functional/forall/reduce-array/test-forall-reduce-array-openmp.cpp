@@ -0,0 +1,23 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "test-forall-reduce-array.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+// Cartesian product of types for OpenMP tests
+using OpenMPForallReduceArrayTypes =
+  Test< camp::cartesian_product<ReduceArrayDataTypeList,
+                                HostResourceList,
+                                OpenMPForallExecPols,
+                                camp::list<RAJA::omp_reduce>>>::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(OpenMP,
+                               ForallReduceArrayTest,
+                               OpenMPForallReduceArrayTypes);
+
+#endif
@@ -0,0 +1,37 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_REDUCE_ARRAY_HPP__
+#define __TEST_FORALL_REDUCE_ARRAY_HPP__
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_test-camp.hpp"
+#include "RAJA_test-index-types.hpp"
+
+#include "RAJA_test-forall-data.hpp"
+#include "RAJA_test-forall-execpol.hpp"
+
+TYPED_TEST_SUITE_P(ForallReduceArrayTest);
+template <typename T>
+class ForallReduceArrayTest : public ::testing::Test
+{
+};
+
+
+//
+// Data types for array reduction tests
+//
+using ReduceArrayDataTypeList = camp::list<int,
+                                           double>;
+
+#include "tests/test-forall-reduce-array-sum.hpp"
+
+REGISTER_TYPED_TEST_SUITE_P(ForallReduceArrayTest,
+                            ReduceSumArrayForall,
+                            ReduceSumArrayDynamicForall);
+
+#endif  // __TEST_FORALL_REDUCE_ARRAY_HPP__
@@ -0,0 +1,181 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_REDUCESUMARRAY_HPP__
+#define __TEST_FORALL_REDUCESUMARRAY_HPP__
+
+#include <cstdlib>
+#include <vector>
+
+template <typename DATA_TYPE, typename WORKING_RES,
+          typename EXEC_POLICY, typename REDUCE_POLICY>
+void ForallReduceSumArrayTest(RAJA::Index_type first, RAJA::Index_type last)
+{
+  RAJA::TypedRangeSegment<RAJA::Index_type> r1(first, last);
+
+  camp::resources::Resource working_res{WORKING_RES()};
+  DATA_TYPE* working_array;
+  DATA_TYPE* check_array;
+  DATA_TYPE* test_array;
+
+  allocateForallTestData<DATA_TYPE>(last,
+                                    working_res,
+                                    &working_array,
+                                    &check_array,
+                                    &test_array);
+
+  constexpr RAJA::Index_type nsums = 16;
+  const int modval = 100;
+
+  for (RAJA::Index_type i = 0; i < last; ++i) {
+    test_array[i] = static_cast<DATA_TYPE>( rand() % modval );
+  }
+
+  std::vector<DATA_TYPE> ref_sums(nsums, 2);
+  for (RAJA::Index_type i = first; i < last; ++i) {
+    ref_sums[i % nsums] += test_array[i];
+  }
+
+  working_res.memcpy(working_array, test_array, sizeof(DATA_TYPE) * last);
+
+
+  RAJA::ReduceSumArray<REDUCE_POLICY, DATA_TYPE, nsums> sums(2);
+
+  RAJA::forall<EXEC_POLICY>(r1, [=](RAJA::Index_type idx) {
+    sums[idx % nsums] += working_array[idx];
+  });
+
+  auto result = sums.get();
+  for (RAJA::Index_type k = 0; k < nsums; ++k) {
+    ASSERT_EQ(result[k], ref_sums[k]);
+  }
+
+  sums.reset(0);
+
+  const int nloops = 2;
+
+  for (int j = 0; j < nloops; ++j) {
+    RAJA::forall<EXEC_POLICY>(r1, [=](RAJA::Index_type idx) {
+      sums[idx % nsums] += working_array[idx];
+    });
+  }
+
+  result = sums.get();
+  for (RAJA::Index_type k = 0; k < nsums; ++k) {
+    ASSERT_EQ(result[k], nloops * (ref_sums[k] - 2));
+  }
+
+  deallocateForallTestData<DATA_TYPE>(working_res,
+                                      working_array,
+                                      check_array,
+                                      test_array);
+}
+
+template <typename DATA_TYPE, typename WORKING_RES,
+          typename EXEC_POLICY, typename REDUCE_POLICY>
+void ForallReduceSumArrayDynamicTest(RAJA::Index_type first,
+                                     RAJA::Index_type last,
+                                     RAJA::Index_type nsums)
+{
+  RAJA::TypedRangeSegment<RAJA::Index_type> r1(first, last);
+
+  camp::resources::Resource working_res{WORKING_RES()};
+  DATA_TYPE* working_array;
+  DATA_TYPE* check_array;
+  DATA_TYPE* test_array;
+
+  allocateForallTestData<DATA_TYPE>(last,
+                                    working_res,
+                                    &working_array,
+                                    &check_array,
+                                    &test_array);
+
+  const int modval = 100;
+
+  for (RAJA::Index_type i = 0; i < last; ++i) {
+    test_array[i] = static_cast<DATA_TYPE>( rand() % modval );
+  }
+
+  std::vector<DATA_TYPE> init_sums(nsums);
+  for (RAJA::Index_type k = 0; k < nsums; ++k) {
+    init_sums[k] = static_cast<DATA_TYPE>(k);
+  }
+
+  std::vector<DATA_TYPE> ref_sums(init_sums);
+  for (RAJA::Index_type i = first; i < last; ++i) {
+    ref_sums[(i * 7) % nsums] += test_array[i];
+  }
+
+  working_res.memcpy(working_array, test_array, sizeof(DATA_TYPE) * last);
+
+
+  RAJA::ReduceSumArray<REDUCE_POLICY, DATA_TYPE> sums(init_sums);
+  RAJA::ReduceSumArray<REDUCE_POLICY, DATA_TYPE> counts(nsums);
+
+  RAJA::forall<EXEC_POLICY>(r1, [=](RAJA::Index_type idx) {
+    sums[(idx * 7) % nsums] += working_array[idx];
+    counts[idx % nsums] += 1;
+  });
+
+  auto result = sums.get();
+  auto count_result = counts.get();
+  ASSERT_EQ(static_cast<RAJA::Index_type>(result.size()), nsums);
+  for (RAJA::Index_type k = 0; k < nsums; ++k) {
+    ASSERT_EQ(result[k], ref_sums[k]);
+  }
+
+  DATA_TYPE total = 0;
+  for (RAJA::Index_type k = 0; k < nsums; ++k) {
+    total += count_result[k];
+  }
+  ASSERT_EQ(total, static_cast<DATA_TYPE>(last - first));
+
+  counts.reset();
+  count_result = counts.get();
+  ASSERT_EQ(static_cast<RAJA::Index_type>(count_result.size()), nsums);
+  for (RAJA::Index_type k = 0; k < nsums; ++k) {
+    ASSERT_EQ(count_result[k], static_cast<DATA_TYPE>(0));
+  }
+
+  deallocateForallTestData<DATA_TYPE>(working_res,
+                                      working_array,
+                                      check_array,
+                                      test_array);
+}
+
+
+TYPED_TEST_P(ForallReduceArrayTest, ReduceSumArrayForall)
+{
+  using DATA_TYPE     = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES   = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY   = typename camp::at<TypeParam, camp::num<2>>::type;
+  using REDUCE_POLICY = typename camp::at<TypeParam, camp::num<3>>::type;
+
+  ForallReduceSumArrayTest<DATA_TYPE, WORKING_RES,
+                           EXEC_POLICY, REDUCE_POLICY>(0, 28);
+  ForallReduceSumArrayTest<DATA_TYPE, WORKING_RES,
+                           EXEC_POLICY, REDUCE_POLICY>(3, 642);
+  ForallReduceSumArrayTest<DATA_TYPE, WORKING_RES,
+                           EXEC_POLICY, REDUCE_POLICY>(0, 2057);
+}
+
+TYPED_TEST_P(ForallReduceArrayTest, ReduceSumArrayDynamicForall)
+{
+  using DATA_TYPE     = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES   = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY   = typename camp::at<TypeParam, camp::num<2>>::type;
+  using REDUCE_POLICY = typename camp::at<TypeParam, camp::num<3>>::type;
+
+  ForallReduceSumArrayDynamicTest<DATA_TYPE, WORKING_RES,
+                                  EXEC_POLICY, REDUCE_POLICY>(0, 28, 1);
+  ForallReduceSumArrayDynamicTest<DATA_TYPE, WORKING_RES,
+                                  EXEC_POLICY, REDUCE_POLICY>(3, 642, 37);
+  ForallReduceSumArrayDynamicTest<DATA_TYPE, WORKING_RES,
+                                  EXEC_POLICY, REDUCE_POLICY>(0, 2057, 64);
+}
+
+#endif  // __TEST_FORALL_REDUCESUMARRAY_HPP__
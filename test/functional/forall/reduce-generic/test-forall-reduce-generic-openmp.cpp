@@ -0,0 +1,24 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "test-forall-reduce-generic.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+// Cartesian product of types for OpenMP tests
+using OpenMPForallReduceGenericTypes =
+  Test< camp::cartesian_product<ReduceGenericDataTypeList,
+                                HostResourceList,
+                                OpenMPForallExecPols,
+                                camp::list<RAJA::omp_reduce,
+                                           RAJA::omp_reduce_ordered>>>::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(OpenMP,
+                               ForallReduceGenericTest,
+                               OpenMPForallReduceGenericTypes);
+
+#endif
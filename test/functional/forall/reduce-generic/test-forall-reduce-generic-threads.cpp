@@ -0,0 +1,23 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "test-forall-reduce-generic.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+// Cartesian product of types for threads tests
+using ThreadsForallReduceGenericTypes =
+  Test< camp::cartesian_product<ReduceGenericDataTypeList,
+                                HostResourceList,
+                                ThreadsForallExecPols,
+                                camp::list<RAJA::threads_reduce>>>::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(Threads,
+                               ForallReduceGenericTest,
+                               ThreadsForallReduceGenericTypes);
+
+#endif
@@ -0,0 +1,37 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_REDUCE_GENERIC_HPP__
+#define __TEST_FORALL_REDUCE_GENERIC_HPP__
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_test-camp.hpp"
+#include "RAJA_test-index-types.hpp"
+
+#include "RAJA_test-forall-data.hpp"
+#include "RAJA_test-forall-execpol.hpp"
+
+TYPED_TEST_SUITE_P(ForallReduceGenericTest);
+template <typename T>
+class ForallReduceGenericTest : public ::testing::Test
+{
+};
+
+
+//
+// Data types for generic reduction tests
+//
+using ReduceGenericDataTypeList = camp::list<int,
+                                             double>;
+
+#include "tests/test-forall-reduce-generic-stats.hpp"
+
+REGISTER_TYPED_TEST_SUITE_P(ForallReduceGenericTest,
+                            ReducerStatsForall,
+                            ReducerBoundsForall);
+
+#endif  // __TEST_FORALL_REDUCE_GENERIC_HPP__
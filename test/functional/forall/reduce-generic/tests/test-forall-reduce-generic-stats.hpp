@@ -0,0 +1,251 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_REDUCER_STATS_HPP__
+#define __TEST_FORALL_REDUCER_STATS_HPP__
+
+#include <algorithm>
+#include <cstdlib>
+
+//
+// Count, sum, min and max of values in one reducer; has no operator!=
+//
+template <typename T>
+struct TestStats {
+  RAJA::Index_type count;
+  T sum;
+  T min;
+  T max;
+};
+
+template <typename T>
+struct TestStatsOp {
+  static TestStats<T> identity()
+  {
+    return TestStats<T>{0,
+                        T(0),
+                        RAJA::operators::limits<T>::max(),
+                        RAJA::operators::limits<T>::min()};
+  }
+
+  TestStats<T> operator()(TestStats<T> const& a, TestStats<T> const& b) const
+  {
+    return TestStats<T>{a.count + b.count,
+                        a.sum + b.sum,
+                        std::min(a.min, b.min),
+                        std::max(a.max, b.max)};
+  }
+};
+
+//
+// Bounds of (value, index) points, with no static identity
+//
+template <typename T>
+struct TestBounds {
+  T lo;
+  T hi;
+  RAJA::Index_type first;
+  RAJA::Index_type last;
+
+  bool operator!=(TestBounds const& o) const
+  {
+    return lo != o.lo || hi != o.hi || first != o.first || last != o.last;
+  }
+};
+
+template <typename T>
+struct TestBoundsOp {
+  TestBounds<T> operator()(TestBounds<T> const& a,
+                           TestBounds<T> const& b) const
+  {
+    return TestBounds<T>{std::min(a.lo, b.lo),
+                         std::max(a.hi, b.hi),
+                         std::min(a.first, b.first),
+                         std::max(a.last, b.last)};
+  }
+};
+
+template <typename DATA_TYPE, typename WORKING_RES,
+          typename EXEC_POLICY, typename REDUCE_POLICY>
+void ForallReducerStatsTest(RAJA::Index_type first, RAJA::Index_type last)
+{
+  RAJA::TypedRangeSegment<RAJA::Index_type> r1(first, last);
+
+  camp::resources::Resource working_res{WORKING_RES()};
+  DATA_TYPE* working_array;
+  DATA_TYPE* check_array;
+  DATA_TYPE* test_array;
+
+  allocateForallTestData<DATA_TYPE>(last,
+                                    working_res,
+                                    &working_array,
+                                    &check_array,
+                                    &test_array);
+
+  const int modval = 100;
+
+  for (RAJA::Index_type i = 0; i < last; ++i) {
+    test_array[i] = static_cast<DATA_TYPE>( rand() % modval - modval / 2 );
+  }
+
+  TestStats<DATA_TYPE> ref = TestStatsOp<DATA_TYPE>::identity();
+  for (RAJA::Index_type i = first; i < last; ++i) {
+    const DATA_TYPE val = test_array[i];
+    ref = TestStatsOp<DATA_TYPE>{}(ref, TestStats<DATA_TYPE>{1, val, val, val});
+  }
+
+  working_res.memcpy(working_array, test_array, sizeof(DATA_TYPE) * last);
+
+
+  RAJA::Reducer<REDUCE_POLICY, TestStats<DATA_TYPE>, TestStatsOp<DATA_TYPE>>
+      stats(TestStatsOp<DATA_TYPE>::identity());
+
+  RAJA::forall<EXEC_POLICY>(r1, [=](RAJA::Index_type idx) {
+    const DATA_TYPE val = working_array[idx];
+    stats.combine(TestStats<DATA_TYPE>{1, val, val, val});
+  });
+
+  TestStats<DATA_TYPE> result = stats.get();
+  ASSERT_EQ(result.count, last - first);
+  ASSERT_EQ(result.sum, ref.sum);
+  ASSERT_EQ(result.min, ref.min);
+  ASSERT_EQ(result.max, ref.max);
+
+  const int nloops = 2;
+
+  for (int j = 0; j < nloops; ++j) {
+    RAJA::forall<EXEC_POLICY>(r1, [=](RAJA::Index_type idx) {
+      const DATA_TYPE val = working_array[idx];
+      stats.combine(TestStats<DATA_TYPE>{1, val, val, val});
+    });
+  }
+
+  result = stats.get();
+  ASSERT_EQ(result.count, (nloops + 1) * (last - first));
+  ASSERT_EQ(result.sum, static_cast<DATA_TYPE>((nloops + 1) * ref.sum));
+  ASSERT_EQ(result.min, ref.min);
+  ASSERT_EQ(result.max, ref.max);
+
+  stats.reset(TestStatsOp<DATA_TYPE>::identity());
+  ASSERT_EQ(stats.get().count, 0);
+
+  // default constructed reducers start from the identity, not T()
+  RAJA::Reducer<REDUCE_POLICY, TestStats<DATA_TYPE>, TestStatsOp<DATA_TYPE>>
+      above;
+  RAJA::Reducer<REDUCE_POLICY, TestStats<DATA_TYPE>, TestStatsOp<DATA_TYPE>>
+      below;
+
+  RAJA::forall<EXEC_POLICY>(r1, [=](RAJA::Index_type idx) {
+    const DATA_TYPE val = working_array[idx];
+    above.combine(TestStats<DATA_TYPE>{1, val + modval, val + modval,
+                                       val + modval});
+    below.combine(TestStats<DATA_TYPE>{1, val - modval, val - modval,
+                                       val - modval});
+  });
+
+  result = above.get();
+  ASSERT_EQ(result.count, last - first);
+  ASSERT_EQ(result.min, static_cast<DATA_TYPE>(ref.min + modval));
+  ASSERT_EQ(result.max, static_cast<DATA_TYPE>(ref.max + modval));
+
+  result = below.get();
+  ASSERT_EQ(result.count, last - first);
+  ASSERT_EQ(result.min, static_cast<DATA_TYPE>(ref.min - modval));
+  ASSERT_EQ(result.max, static_cast<DATA_TYPE>(ref.max - modval));
+
+  deallocateForallTestData<DATA_TYPE>(working_res,
+                                      working_array,
+                                      check_array,
+                                      test_array);
+}
+
+template <typename DATA_TYPE, typename WORKING_RES,
+          typename EXEC_POLICY, typename REDUCE_POLICY>
+void ForallReducerBoundsTest(RAJA::Index_type first, RAJA::Index_type last)
+{
+  RAJA::TypedRangeSegment<RAJA::Index_type> r1(first, last);
+
+  camp::resources::Resource working_res{WORKING_RES()};
+  DATA_TYPE* working_array;
+  DATA_TYPE* check_array;
+  DATA_TYPE* test_array;
+
+  allocateForallTestData<DATA_TYPE>(last,
+                                    working_res,
+                                    &working_array,
+                                    &check_array,
+                                    &test_array);
+
+  const int modval = 100;
+
+  for (RAJA::Index_type i = 0; i < last; ++i) {
+    test_array[i] = static_cast<DATA_TYPE>( rand() % modval );
+  }
+  test_array[first] = static_cast<DATA_TYPE>(-1);
+  test_array[last - 1] = static_cast<DATA_TYPE>(modval);
+
+  working_res.memcpy(working_array, test_array, sizeof(DATA_TYPE) * last);
+
+
+  const TestBounds<DATA_TYPE> identity{
+      RAJA::operators::limits<DATA_TYPE>::max(),
+      RAJA::operators::limits<DATA_TYPE>::min(),
+      last,
+      first};
+
+  RAJA::Reducer<REDUCE_POLICY, TestBounds<DATA_TYPE>, TestBoundsOp<DATA_TYPE>>
+      bounds(identity, identity);
+
+  RAJA::forall<EXEC_POLICY>(r1, [=](RAJA::Index_type idx) {
+    const DATA_TYPE val = working_array[idx];
+    bounds.combine(TestBounds<DATA_TYPE>{val, val, idx, idx});
+  });
+
+  TestBounds<DATA_TYPE> result = bounds.get();
+  ASSERT_EQ(result.lo, static_cast<DATA_TYPE>(-1));
+  ASSERT_EQ(result.hi, static_cast<DATA_TYPE>(modval));
+  ASSERT_EQ(result.first, first);
+  ASSERT_EQ(result.last, last - 1);
+
+  deallocateForallTestData<DATA_TYPE>(working_res,
+                                      working_array,
+                                      check_array,
+                                      test_array);
+}
+
+
+TYPED_TEST_P(ForallReduceGenericTest, ReducerStatsForall)
+{
+  using DATA_TYPE     = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES   = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY   = typename camp::at<TypeParam, camp::num<2>>::type;
+  using REDUCE_POLICY = typename camp::at<TypeParam, camp::num<3>>::type;
+
+  ForallReducerStatsTest<DATA_TYPE, WORKING_RES,
+                         EXEC_POLICY, REDUCE_POLICY>(0, 28);
+  ForallReducerStatsTest<DATA_TYPE, WORKING_RES,
+                         EXEC_POLICY, REDUCE_POLICY>(3, 642);
+  ForallReducerStatsTest<DATA_TYPE, WORKING_RES,
+                         EXEC_POLICY, REDUCE_POLICY>(0, 2057);
+}
+
+TYPED_TEST_P(ForallReduceGenericTest, ReducerBoundsForall)
+{
+  using DATA_TYPE     = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES   = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY   = typename camp::at<TypeParam, camp::num<2>>::type;
+  using REDUCE_POLICY = typename camp::at<TypeParam, camp::num<3>>::type;
+
+  ForallReducerBoundsTest<DATA_TYPE, WORKING_RES,
+                          EXEC_POLICY, REDUCE_POLICY>(0, 28);
+  ForallReducerBoundsTest<DATA_TYPE, WORKING_RES,
+                          EXEC_POLICY, REDUCE_POLICY>(3, 642);
+  ForallReducerBoundsTest<DATA_TYPE, WORKING_RES,
+                          EXEC_POLICY, REDUCE_POLICY>(0, 2057);
+}
+
+#endif  // __TEST_FORALL_REDUCER_STATS_HPP__
@@ -0,0 +1,22 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "test-forall-reduce-param.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+// Cartesian product of types for Threads tests
+using ThreadsForallReduceParamTypes =
+  Test< camp::cartesian_product<ReduceParamDataTypeList,
+                                HostResourceList,
+                                ThreadsForallExecPols>>::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(Threads,
+                               ForallReduceParamTest,
+                               ThreadsForallReduceParamTypes);
+
+#endif
@@ -0,0 +1,176 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_REDUCE_PARAM_BASIC_HPP__
+#define __TEST_FORALL_REDUCE_PARAM_BASIC_HPP__
+
+#include <algorithm>
+#include <cstdlib>
+
+//
+// One reduction parameter per loop, which OpenMP reduces with a clause
+//
+template <typename DATA_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallReduceParamSingleTest(RAJA::Index_type first,
+                                 RAJA::Index_type last)
+{
+  RAJA::TypedRangeSegment<RAJA::Index_type> r1(first, last);
+
+  camp::resources::Resource working_res{WORKING_RES()};
+  DATA_TYPE* working_array;
+  DATA_TYPE* check_array;
+  DATA_TYPE* test_array;
+
+  allocateForallTestData<DATA_TYPE>(last,
+                                    working_res,
+                                    &working_array,
+                                    &check_array,
+                                    &test_array);
+
+  const int modval = 100;
+
+  for (RAJA::Index_type i = 0; i < last; ++i) {
+    test_array[i] = static_cast<DATA_TYPE>( rand() % modval - modval / 2 );
+  }
+
+  DATA_TYPE ref_sum = 0;
+  DATA_TYPE ref_min = RAJA::operators::limits<DATA_TYPE>::max();
+  for (RAJA::Index_type i = first; i < last; ++i) {
+    ref_sum += test_array[i];
+    ref_min = std::min(ref_min, test_array[i]);
+  }
+
+  working_res.memcpy(working_array, test_array, sizeof(DATA_TYPE) * last);
+
+
+  DATA_TYPE sum = static_cast<DATA_TYPE>(5);
+
+  RAJA::forall_param<EXEC_POLICY>(r1,
+    RAJA::Reduce<RAJA::operators::plus>(&sum),
+    [=](RAJA::Index_type idx, DATA_TYPE& s) {
+      s += working_array[idx];
+    });
+
+  ASSERT_EQ(sum, static_cast<DATA_TYPE>(ref_sum + 5));
+
+  DATA_TYPE vmin = static_cast<DATA_TYPE>(modval);
+
+  const int nloops = 2;
+
+  for (int j = 0; j < nloops; ++j) {
+    RAJA::forall_param<EXEC_POLICY>(r1,
+      RAJA::Reduce<RAJA::operators::minimum>(&vmin),
+      [=](RAJA::Index_type idx, DATA_TYPE& m) {
+        m = RAJA_MIN(m, working_array[idx]);
+      });
+  }
+
+  ASSERT_EQ(vmin, ref_min);
+
+  deallocateForallTestData<DATA_TYPE>(working_res,
+                                      working_array,
+                                      check_array,
+                                      test_array);
+}
+
+//
+// Several reduction parameters of different types in one loop
+//
+template <typename DATA_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallReduceParamMultipleTest(RAJA::Index_type first,
+                                   RAJA::Index_type last)
+{
+  RAJA::TypedRangeSegment<RAJA::Index_type> r1(first, last);
+
+  camp::resources::Resource working_res{WORKING_RES()};
+  DATA_TYPE* working_array;
+  DATA_TYPE* check_array;
+  DATA_TYPE* test_array;
+
+  allocateForallTestData<DATA_TYPE>(last,
+                                    working_res,
+                                    &working_array,
+                                    &check_array,
+                                    &test_array);
+
+  const int modval = 100;
+
+  for (RAJA::Index_type i = 0; i < last; ++i) {
+    test_array[i] = static_cast<DATA_TYPE>( rand() % modval );
+  }
+  test_array[first] = static_cast<DATA_TYPE>(-1);
+  test_array[last - 1] = static_cast<DATA_TYPE>(modval);
+
+  DATA_TYPE ref_sum = 0;
+  for (RAJA::Index_type i = first; i < last; ++i) {
+    ref_sum += test_array[i];
+  }
+
+  working_res.memcpy(working_array, test_array, sizeof(DATA_TYPE) * last);
+
+
+  DATA_TYPE sum = 0;
+  DATA_TYPE vmin = RAJA::operators::limits<DATA_TYPE>::max();
+  DATA_TYPE vmax = RAJA::operators::limits<DATA_TYPE>::min();
+  RAJA::Index_type count = 0;
+
+  const int nloops = 3;
+
+  for (int j = 0; j < nloops; ++j) {
+    RAJA::forall_param<EXEC_POLICY>(r1,
+      RAJA::Reduce<RAJA::operators::plus>(&sum),
+      RAJA::Reduce<RAJA::operators::minimum>(&vmin),
+      RAJA::Reduce<RAJA::operators::maximum>(&vmax),
+      RAJA::Reduce<RAJA::operators::plus>(&count),
+      [=](RAJA::Index_type idx,
+          DATA_TYPE& s,
+          DATA_TYPE& mn,
+          DATA_TYPE& mx,
+          RAJA::Index_type& c) {
+        const DATA_TYPE val = working_array[idx];
+        s += val;
+        mn = RAJA_MIN(mn, val);
+        mx = RAJA_MAX(mx, val);
+        c += 1;
+      });
+  }
+
+  ASSERT_EQ(sum, static_cast<DATA_TYPE>(nloops * ref_sum));
+  ASSERT_EQ(vmin, static_cast<DATA_TYPE>(-1));
+  ASSERT_EQ(vmax, static_cast<DATA_TYPE>(modval));
+  ASSERT_EQ(count, nloops * (last - first));
+
+  deallocateForallTestData<DATA_TYPE>(working_res,
+                                      working_array,
+                                      check_array,
+                                      test_array);
+}
+
+
+TYPED_TEST_P(ForallReduceParamTest, ReduceParamSingleForall)
+{
+  using DATA_TYPE   = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ForallReduceParamSingleTest<DATA_TYPE, WORKING_RES, EXEC_POLICY>(0, 28);
+  ForallReduceParamSingleTest<DATA_TYPE, WORKING_RES, EXEC_POLICY>(3, 642);
+  ForallReduceParamSingleTest<DATA_TYPE, WORKING_RES, EXEC_POLICY>(0, 2057);
+}
+
+TYPED_TEST_P(ForallReduceParamTest, ReduceParamMultipleForall)
+{
+  using DATA_TYPE   = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ForallReduceParamMultipleTest<DATA_TYPE, WORKING_RES, EXEC_POLICY>(0, 28);
+  ForallReduceParamMultipleTest<DATA_TYPE, WORKING_RES, EXEC_POLICY>(3, 642);
+  ForallReduceParamMultipleTest<DATA_TYPE, WORKING_RES, EXEC_POLICY>(0, 2057);
+}
+
+#endif  // __TEST_FORALL_REDUCE_PARAM_BASIC_HPP__
@@ -0,0 +1,19 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "test-forall-reduce-reproducible.hpp"
+
+// Cartesian product of types for Sequential tests
+using SequentialForallReduceReproducibleTypes =
+  Test< camp::cartesian_product<ReduceReproducibleDataTypeList,
+                                HostResourceList,
+                                SequentialForallReduceExecPols,
+                                SequentialReproducibleReducePols>>::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(Sequential,
+                               ForallReduceReproducibleTest,
+                               SequentialForallReduceReproducibleTypes);
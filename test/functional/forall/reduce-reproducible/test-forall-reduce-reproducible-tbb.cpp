@@ -0,0 +1,23 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "test-forall-reduce-reproducible.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+// Cartesian product of types for TBB tests
+using TBBForallReduceReproducibleTypes =
+  Test< camp::cartesian_product<ReduceReproducibleDataTypeList,
+                                HostResourceList,
+                                TBBForallExecPols,
+                                TBBReproducibleReducePols>>::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(TBB,
+                               ForallReduceReproducibleTest,
+                               TBBForallReduceReproducibleTypes);
+
+#endif
@@ -0,0 +1,39 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_REDUCE_REPRODUCIBLE_HPP__
+#define __TEST_FORALL_REDUCE_REPRODUCIBLE_HPP__
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_test-camp.hpp"
+#include "RAJA_test-index-types.hpp"
+
+#include "RAJA_test-forall-data.hpp"
+#include "RAJA_test-forall-execpol.hpp"
+#include "RAJA_test-reducepol.hpp"
+
+TYPED_TEST_SUITE_P(ForallReduceReproducibleTest);
+template <typename T>
+class ForallReduceReproducibleTest : public ::testing::Test
+{
+};
+
+
+//
+// Data types for reproducible reduction tests
+//
+using ReduceReproducibleDataTypeList = camp::list<float,
+                                                  double>;
+
+#include "tests/test-forall-reduce-reproducible-sum.hpp"
+#include "tests/test-forall-reduce-reproducible-loc.hpp"
+
+REGISTER_TYPED_TEST_SUITE_P(ForallReduceReproducibleTest,
+                            ReduceSumReproducibleForall,
+                            ReduceMinLocReproducibleForall);
+
+#endif  // __TEST_FORALL_REDUCE_REPRODUCIBLE_HPP__
@@ -0,0 +1,74 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_REDUCELOC_REPRODUCIBLE_HPP__
+#define __TEST_FORALL_REDUCELOC_REPRODUCIBLE_HPP__
+
+template <typename DATA_TYPE, typename WORKING_RES,
+          typename EXEC_POLICY, typename REDUCE_POLICY>
+void ForallReduceMinLocReproducibleTest(RAJA::Index_type first,
+                                        RAJA::Index_type last)
+{
+  RAJA::TypedRangeSegment<RAJA::Index_type> r1(first, last);
+
+  camp::resources::Resource working_res{WORKING_RES()};
+  DATA_TYPE* working_array;
+  DATA_TYPE* check_array;
+  DATA_TYPE* test_array;
+
+  allocateForallTestData<DATA_TYPE>(last,
+                                    working_res,
+                                    &working_array,
+                                    &check_array,
+                                    &test_array);
+
+  // every value occurs many times; ties keep the smallest index
+  for (RAJA::Index_type i = 0; i < last; ++i) {
+    test_array[i] = static_cast<DATA_TYPE>(i % 10);
+  }
+
+  const RAJA::Index_type ref_minloc = (first + 9) / 10 * 10;
+  const RAJA::Index_type ref_maxloc = first / 10 * 10 + 9;
+
+  working_res.memcpy(working_array, test_array, sizeof(DATA_TYPE) * last);
+
+  RAJA::ReduceMinLoc<REDUCE_POLICY, DATA_TYPE, RAJA::Index_type> min(100, -1);
+  RAJA::ReduceMaxLoc<REDUCE_POLICY, DATA_TYPE, RAJA::Index_type> max(-1, -1);
+
+  RAJA::forall<EXEC_POLICY>(r1, [=](RAJA::Index_type idx) {
+    min.minloc(working_array[idx], idx);
+    max.maxloc(working_array[idx], idx);
+  });
+
+  ASSERT_EQ(static_cast<DATA_TYPE>(min.get()), static_cast<DATA_TYPE>(0));
+  ASSERT_EQ(static_cast<RAJA::Index_type>(min.getLoc()), ref_minloc);
+  ASSERT_EQ(static_cast<DATA_TYPE>(max.get()), static_cast<DATA_TYPE>(9));
+  ASSERT_EQ(static_cast<RAJA::Index_type>(max.getLoc()), ref_maxloc);
+
+  deallocateForallTestData<DATA_TYPE>(working_res,
+                                      working_array,
+                                      check_array,
+                                      test_array);
+}
+
+
+TYPED_TEST_P(ForallReduceReproducibleTest, ReduceMinLocReproducibleForall)
+{
+  using DATA_TYPE     = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES   = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY   = typename camp::at<TypeParam, camp::num<2>>::type;
+  using REDUCE_POLICY = typename camp::at<TypeParam, camp::num<3>>::type;
+
+  ForallReduceMinLocReproducibleTest<DATA_TYPE, WORKING_RES,
+                                     EXEC_POLICY, REDUCE_POLICY>(0, 28);
+  ForallReduceMinLocReproducibleTest<DATA_TYPE, WORKING_RES,
+                                     EXEC_POLICY, REDUCE_POLICY>(3, 642);
+  ForallReduceMinLocReproducibleTest<DATA_TYPE, WORKING_RES,
+                                     EXEC_POLICY, REDUCE_POLICY>(0, 2057);
+}
+
+#endif  // __TEST_FORALL_REDUCELOC_REPRODUCIBLE_HPP__
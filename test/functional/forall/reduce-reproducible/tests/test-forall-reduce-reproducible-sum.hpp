@@ -0,0 +1,149 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_REDUCESUM_REPRODUCIBLE_HPP__
+#define __TEST_FORALL_REDUCESUM_REPRODUCIBLE_HPP__
+
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+
+template <typename DATA_TYPE, typename WORKING_RES,
+          typename EXEC_POLICY, typename REDUCE_POLICY>
+void ForallReduceSumReproducibleTest(RAJA::Index_type first,
+                                     RAJA::Index_type last)
+{
+  RAJA::TypedRangeSegment<RAJA::Index_type> r1(first, last);
+
+  camp::resources::Resource working_res{WORKING_RES()};
+  DATA_TYPE* working_array;
+  DATA_TYPE* check_array;
+  DATA_TYPE* test_array;
+
+  allocateForallTestData<DATA_TYPE>(last,
+                                    working_res,
+                                    &working_array,
+                                    &check_array,
+                                    &test_array);
+
+  //
+  // Large values that cancel in pairs, shuffled among small integers. The
+  // exact sum is the sum of the integers, which a sum that rounds as it
+  // goes loses.
+  //
+  const RAJA::Index_type n = last - first;
+  DATA_TYPE ref_sum = 0;
+
+  for (RAJA::Index_type i = 0; i < first; ++i) {
+    test_array[i] = 0;
+  }
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    DATA_TYPE val;
+    if (i % 3 == 0 && i + 1 < n) {
+      val = std::ldexp(static_cast<DATA_TYPE>(rand() % 1000 + 1),
+                       rand() % 40);
+    } else if (i % 3 == 1) {
+      val = -test_array[first + i - 1];
+    } else {
+      val = static_cast<DATA_TYPE>(rand() % 201 - 100);
+      ref_sum += val;
+    }
+    test_array[first + i] = val;
+  }
+  for (RAJA::Index_type i = n - 1; i > 0; --i) {
+    std::swap(test_array[first + i], test_array[first + rand() % (i + 1)]);
+  }
+
+  working_res.memcpy(working_array, test_array, sizeof(DATA_TYPE) * last);
+
+  RAJA::ReduceSum<REDUCE_POLICY, DATA_TYPE> sum(0);
+
+  RAJA::forall<EXEC_POLICY>(r1, [=](RAJA::Index_type idx) {
+    sum += working_array[idx];
+  });
+
+  ASSERT_EQ(static_cast<DATA_TYPE>(sum.get()), ref_sum);
+
+  //
+  // Values of many magnitudes must sum to exactly what a sequential
+  // reproducible sum gives, however the loop was split.
+  //
+  for (RAJA::Index_type i = 0; i < last; ++i) {
+    test_array[i] =
+        std::ldexp(static_cast<DATA_TYPE>(rand() % 2001 - 1000) / 7,
+                   rand() % 60 - 30);
+  }
+
+  working_res.memcpy(working_array, test_array, sizeof(DATA_TYPE) * last);
+
+  RAJA::ReduceSum<RAJA::seq_reduce_reproducible, DATA_TYPE> seq_sum(0);
+  for (RAJA::Index_type i = first; i < last; ++i) {
+    seq_sum += test_array[i];
+  }
+
+  sum.reset(0);
+
+  RAJA::forall<EXEC_POLICY>(r1, [=](RAJA::Index_type idx) {
+    sum += working_array[idx];
+  });
+
+  ASSERT_EQ(static_cast<DATA_TYPE>(sum.get()),
+            static_cast<DATA_TYPE>(seq_sum.get()));
+
+  RAJA::forall<EXEC_POLICY>(r1, [=](RAJA::Index_type idx) {
+    sum += working_array[idx];
+  });
+
+  ASSERT_EQ(static_cast<DATA_TYPE>(sum.get()),
+            2 * static_cast<DATA_TYPE>(seq_sum.get()));
+
+  //
+  // Half an ulp of 1 plus a little more rounds up, which rounding the
+  // exact sum a digit at a time misses.
+  //
+  const DATA_TYPE eps = std::numeric_limits<DATA_TYPE>::epsilon();
+  for (RAJA::Index_type i = 0; i < last; ++i) {
+    test_array[i] = 0;
+  }
+  test_array[first] = 1;
+  test_array[last - 1] = eps / 2;
+  test_array[(first + last) / 2] = std::ldexp(eps, -30);
+
+  working_res.memcpy(working_array, test_array, sizeof(DATA_TYPE) * last);
+
+  sum.reset(0);
+
+  RAJA::forall<EXEC_POLICY>(r1, [=](RAJA::Index_type idx) {
+    sum += working_array[idx];
+  });
+
+  ASSERT_EQ(static_cast<DATA_TYPE>(sum.get()), 1 + eps);
+
+  deallocateForallTestData<DATA_TYPE>(working_res,
+                                      working_array,
+                                      check_array,
+                                      test_array);
+}
+
+
+TYPED_TEST_P(ForallReduceReproducibleTest, ReduceSumReproducibleForall)
+{
+  using DATA_TYPE     = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES   = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY   = typename camp::at<TypeParam, camp::num<2>>::type;
+  using REDUCE_POLICY = typename camp::at<TypeParam, camp::num<3>>::type;
+
+  ForallReduceSumReproducibleTest<DATA_TYPE, WORKING_RES,
+                                  EXEC_POLICY, REDUCE_POLICY>(0, 28);
+  ForallReduceSumReproducibleTest<DATA_TYPE, WORKING_RES,
+                                  EXEC_POLICY, REDUCE_POLICY>(3, 642);
+  ForallReduceSumReproducibleTest<DATA_TYPE, WORKING_RES,
+                                  EXEC_POLICY, REDUCE_POLICY>(0, 2057);
+}
+
+#endif  // __TEST_FORALL_REDUCESUM_REPRODUCIBLE_HPP__
@@ -20,4 +20,19 @@ INSTANTIATE_TYPED_TEST_SUITE_P(TBB,
                                ForallReduceSanityTest,
                                TBBForallReduceSanityTypes);
 
+#if defined(RAJA_ENABLE_OPENMP)
+
+// OpenMP reducers must also be safe on the workers of other back-ends
+using TBBForallReduceSanityOpenMPTypes =
+  Test< camp::cartesian_product<ReduceSanityDataTypeList,
+                                HostResourceList,
+                                TBBForallExecPols,
+                                OpenMPReducePols>>::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(TBBOpenMPReduce,
+                               ForallReduceSanityTest,
+                               TBBForallReduceSanityOpenMPTypes);
+
+#endif
+
 #endif
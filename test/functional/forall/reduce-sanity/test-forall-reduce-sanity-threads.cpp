@@ -0,0 +1,38 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "test-forall-reduce-sanity.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+// Cartesian product of types for threads tests
+using ThreadsForallReduceSanityTypes =
+  Test< camp::cartesian_product<ReduceSanityDataTypeList, 
+                                HostResourceList, 
+                                ThreadsForallExecPols,
+                                ThreadsReducePols>>::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(Threads,
+                               ForallReduceSanityTest,
+                               ThreadsForallReduceSanityTypes);
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+// OpenMP reducers must also be safe on the workers of other back-ends
+using ThreadsForallReduceSanityOpenMPTypes =
+  Test< camp::cartesian_product<ReduceSanityDataTypeList,
+                                HostResourceList,
+                                ThreadsForallExecPols,
+                                OpenMPReducePols>>::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(ThreadsOpenMPReduce,
+                               ForallReduceSanityTest,
+                               ThreadsForallReduceSanityOpenMPTypes);
+
+#endif
+
+#endif
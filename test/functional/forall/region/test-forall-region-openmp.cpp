@@ -13,7 +13,9 @@ using OpenMPRegionPols = camp::list< RAJA::omp_parallel_region >;
 
 using OpenMPForallRegionExecPols =
   camp::list< RAJA::omp_for_nowait_exec,
-              RAJA::omp_for_exec >;
+              RAJA::omp_for_exec,
+              RAJA::omp_taskloop_exec<>,
+              RAJA::omp_taskloop_exec<16> >;
 
 // Cartesian product of types for OpenMP tests
 using OpenMPForallRegionTypes =
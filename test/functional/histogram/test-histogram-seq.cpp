@@ -0,0 +1,16 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "test-histogram.hpp"
+
+using SequentialHistogramTypes = 
+  Test<camp::cartesian_product< SequentialForallExecPols,
+                                HistogramBinTypes >>::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(Sequential, 
+                               HistogramFunctionalTest, 
+                               SequentialHistogramTypes);
@@ -0,0 +1,34 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_HISTOGRAM_HPP__
+#define __TEST_HISTOGRAM_HPP__
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_test-camp.hpp"
+
+#include "RAJA_test-forall-execpol.hpp"
+
+// Histogram functional test class
+template<typename T>
+class HistogramFunctionalTest: public ::testing::Test {};
+
+// Define histogram bin types
+using HistogramBinTypes = camp::list< int,
+                                      long,
+                                      double >;
+
+TYPED_TEST_SUITE_P(HistogramFunctionalTest);
+
+#include "tests/test-histogram.hpp"
+
+REGISTER_TYPED_TEST_SUITE_P(HistogramFunctionalTest,
+                            Histogram,
+                            WeightedHistogram,
+                            ReduceByKey);
+
+#endif //__TEST_HISTOGRAM_HPP__
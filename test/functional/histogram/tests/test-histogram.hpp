@@ -0,0 +1,143 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_HISTOGRAM_TESTS_HPP__
+#define __TEST_HISTOGRAM_TESTS_HPP__
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// keys in [0, num_bins) and small integer weights, so that weighted sums
+// are exact for floating point bins
+inline std::vector<int> makeHistogramKeys(int N, int num_bins)
+{
+  std::mt19937 gen(N + num_bins);
+  std::vector<int> keys(N);
+  for (int i = 0; i < N; ++i) {
+    keys[i] = static_cast<int>(gen() % num_bins);
+  }
+  return keys;
+}
+
+template <typename EXEC_POLICY, typename T>
+void HistogramFunctionalTestImpl(int N, int num_bins, bool weighted)
+{
+  const std::vector<int> keys = makeHistogramKeys(N, num_bins);
+  std::vector<T> weights(N);
+  for (int i = 0; i < N; ++i) {
+    weights[i] = static_cast<T>(i % 5);
+  }
+
+  // bins accumulate into their initial values
+  std::vector<T> ref(num_bins, static_cast<T>(2));
+  std::vector<T> bins(num_bins, static_cast<T>(2));
+  for (int i = 0; i < N; ++i) {
+    ref[keys[i]] += weighted ? weights[i] : static_cast<T>(1);
+  }
+
+  if (weighted) {
+    RAJA::histogram<EXEC_POLICY>(
+        keys.begin(), keys.end(), weights.begin(), bins.data(), num_bins);
+  } else {
+    RAJA::histogram<EXEC_POLICY>(
+        keys.data(), keys.data() + N, bins.begin(), num_bins);
+  }
+
+  for (int b = 0; b < num_bins; ++b) {
+    ASSERT_EQ(ref[b], bins[b]) << "(at bin " << b << ")";
+  }
+}
+
+template <typename EXEC_POLICY, typename T>
+void ReduceByKeyFunctionalTestImpl(int N, int run)
+{
+  std::vector<int> keys(N);
+  std::vector<T> vals(N);
+  for (int i = 0; i < N; ++i) {
+    keys[i] = (i / run) % 3;
+    vals[i] = static_cast<T>(i % 7);
+  }
+
+  std::vector<int> ref_keys;
+  std::vector<T> ref_sums;
+  std::vector<T> ref_maxs;
+  for (int i = 0; i < N; ++i) {
+    if (i == 0 || keys[i] != keys[i - 1]) {
+      ref_keys.push_back(keys[i]);
+      ref_sums.push_back(vals[i]);
+      ref_maxs.push_back(vals[i]);
+    } else {
+      ref_sums.back() += vals[i];
+      ref_maxs.back() = std::max(ref_maxs.back(), vals[i]);
+    }
+  }
+
+  std::vector<int> keys_out(N);
+  std::vector<T> vals_out(N);
+  RAJA::Index_type count = RAJA::reduce_by_key<EXEC_POLICY>(keys.begin(),
+                                                            keys.end(),
+                                                            vals.begin(),
+                                                            keys_out.begin(),
+                                                            vals_out.begin());
+
+  ASSERT_EQ(static_cast<RAJA::Index_type>(ref_keys.size()), count);
+  for (RAJA::Index_type i = 0; i < count; ++i) {
+    ASSERT_EQ(ref_keys[i], keys_out[i]) << "(at run " << i << ")";
+    ASSERT_EQ(ref_sums[i], vals_out[i]) << "(at run " << i << ")";
+  }
+
+  // maximum of every run
+  count = RAJA::reduce_by_key<EXEC_POLICY>(keys.data(),
+                                           keys.data() + N,
+                                           vals.data(),
+                                           keys_out.data(),
+                                           vals_out.data(),
+                                           RAJA::operators::maximum<T>{});
+
+  ASSERT_EQ(static_cast<RAJA::Index_type>(ref_keys.size()), count);
+  for (RAJA::Index_type i = 0; i < count; ++i) {
+    ASSERT_EQ(ref_keys[i], keys_out[i]) << "(at run " << i << ")";
+    ASSERT_EQ(ref_maxs[i], vals_out[i]) << "(at run " << i << ")";
+  }
+}
+
+TYPED_TEST_P(HistogramFunctionalTest, Histogram)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using BIN_TYPE    = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  // few bins are privatized per thread, many bins are sorted
+  HistogramFunctionalTestImpl<EXEC_POLICY, BIN_TYPE>(0, 10, false);
+  HistogramFunctionalTestImpl<EXEC_POLICY, BIN_TYPE>(357, 10, false);
+  HistogramFunctionalTestImpl<EXEC_POLICY, BIN_TYPE>(32000, 16, false);
+  HistogramFunctionalTestImpl<EXEC_POLICY, BIN_TYPE>(32000, 100000, false);
+}
+
+TYPED_TEST_P(HistogramFunctionalTest, WeightedHistogram)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using BIN_TYPE    = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  HistogramFunctionalTestImpl<EXEC_POLICY, BIN_TYPE>(0, 10, true);
+  HistogramFunctionalTestImpl<EXEC_POLICY, BIN_TYPE>(357, 10, true);
+  HistogramFunctionalTestImpl<EXEC_POLICY, BIN_TYPE>(32000, 16, true);
+  HistogramFunctionalTestImpl<EXEC_POLICY, BIN_TYPE>(32000, 100000, true);
+}
+
+TYPED_TEST_P(HistogramFunctionalTest, ReduceByKey)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using VALUE_TYPE  = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  ReduceByKeyFunctionalTestImpl<EXEC_POLICY, VALUE_TYPE>(0, 4);
+  ReduceByKeyFunctionalTestImpl<EXEC_POLICY, VALUE_TYPE>(357, 4);
+  ReduceByKeyFunctionalTestImpl<EXEC_POLICY, VALUE_TYPE>(32000, 1);
+  ReduceByKeyFunctionalTestImpl<EXEC_POLICY, VALUE_TYPE>(32000, 5000);
+}
+
+#endif // __TEST_HISTOGRAM_TESTS_HPP__
@@ -0,0 +1,56 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "test-kernel-region.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+using ThreadsKernelRegionExecPols = 
+  camp::list< 
+
+    RAJA::KernelPolicy<
+      RAJA::statement::Region<RAJA::seq_region,
+        RAJA::statement::For<0, RAJA::threads_for_exec,
+          RAJA::statement::Lambda<0>
+        >,
+        RAJA::statement::For<0, RAJA::threads_for_exec,
+          RAJA::statement::Lambda<1>
+        >,
+        RAJA::statement::For<0, RAJA::threads_for_exec,
+          RAJA::statement::Lambda<2>
+        >
+      >
+    >,
+
+    RAJA::KernelPolicy<
+      RAJA::statement::Region<RAJA::seq_region,
+        RAJA::statement::For<0, RAJA::threads_for_static,
+          RAJA::statement::Lambda<0>
+        >,
+        RAJA::statement::For<0, RAJA::threads_for_dynamic<16>,
+          RAJA::statement::Lambda<1>
+        >,
+        RAJA::statement::For<0, RAJA::threads_for_static,
+          RAJA::statement::Lambda<2>
+        >
+      >
+    >
+
+  >;
+
+
+// Cartesian product of types for Threads tests
+using ThreadsKernelRegionTypes =
+  Test< camp::cartesian_product<IdxTypeList, 
+                                HostResourceList,
+                                ThreadsKernelRegionExecPols> >::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(Threads,
+                               KernelRegionBasicTest,
+                               ThreadsKernelRegionTypes);
+
+#endif
@@ -0,0 +1,22 @@
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "test-scan.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+using ThreadsExclusiveScanTypes = 
+  Test<camp::cartesian_product< ThreadsForallExecPols, 
+                                HostResourceList, 
+                                ScanOpTypes >>::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(Threads, 
+                               ScanFunctionalTest, 
+                               ThreadsExclusiveScanTypes);
+
+#endif
@@ -0,0 +1,35 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SCAN_SEGMENTED_HPP__
+#define __TEST_SCAN_SEGMENTED_HPP__
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_test-camp.hpp"
+
+#include "RAJA_test-forall-execpol.hpp"
+
+// Segmented scan functional test class
+template<typename T>
+class ScanSegmentedFunctionalTest: public ::testing::Test {};
+
+// Define scan operation types
+using ScanSegmentedOpTypes = camp::list< RAJA::operators::plus<int>,
+                                         RAJA::operators::plus<double>,
+                                         RAJA::operators::minimum<int>,
+                                         RAJA::operators::maximum<double> >;
+
+TYPED_TEST_SUITE_P(ScanSegmentedFunctionalTest);
+
+#include "tests/test-scan-segmented.hpp"
+
+REGISTER_TYPED_TEST_SUITE_P(ScanSegmentedFunctionalTest,
+                            ScanInclusiveByKey,
+                            ScanExclusiveByKey,
+                            ScanByFlag);
+
+#endif //__TEST_SCAN_SEGMENTED_HPP__
@@ -0,0 +1,34 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SCAN_TRANSFORM_HPP__
+#define __TEST_SCAN_TRANSFORM_HPP__
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_test-camp.hpp"
+
+#include "RAJA_test-forall-execpol.hpp"
+
+// Transform scan functional test class
+template<typename T>
+class ScanTransformFunctionalTest: public ::testing::Test {};
+
+// Define scan operation types
+using ScanTransformOpTypes = camp::list< RAJA::operators::plus<int>,
+                                         RAJA::operators::plus<double>,
+                                         RAJA::operators::maximum<int>,
+                                         RAJA::operators::maximum<double> >;
+
+TYPED_TEST_SUITE_P(ScanTransformFunctionalTest);
+
+#include "tests/test-scan-transform.hpp"
+
+REGISTER_TYPED_TEST_SUITE_P(ScanTransformFunctionalTest,
+                            ScanTransformInclusive,
+                            ScanTransformExclusive);
+
+#endif //__TEST_SCAN_TRANSFORM_HPP__
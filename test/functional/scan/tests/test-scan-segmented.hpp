@@ -0,0 +1,158 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SCAN_SEGMENTED_TESTS_HPP__
+#define __TEST_SCAN_SEGMENTED_TESTS_HPP__
+
+#include <cstdlib>
+#include <vector>
+
+// keys of segments with lengths in [1, max_len]
+inline std::vector<int> makeSegmentKeys(int N, int max_len)
+{
+  std::vector<int> keys(N);
+  int key = 0;
+  int left = 0;
+  for (int i = 0; i < N; ++i) {
+    if (left == 0) {
+      ++key;
+      left = 1 + std::rand() % max_len;
+    }
+    keys[i] = key;
+    --left;
+  }
+  return keys;
+}
+
+template <typename EXEC_POLICY, typename OP_TYPE>
+void ScanInclusiveByKeyFunctionalTest(int N, int max_len)
+{
+  using T = typename OP_TYPE::result_type;
+
+  std::vector<int> keys = makeSegmentKeys(N, max_len);
+  std::vector<T> in(N);
+  std::vector<T> out(N);
+  for (int i = 0; i < N; ++i) {
+    in[i] = static_cast<T>(i % 13);
+  }
+
+  RAJA::inclusive_scan_by_key<EXEC_POLICY>(keys.begin(),
+                                           keys.end(),
+                                           in.begin(),
+                                           out.begin(),
+                                           OP_TYPE{});
+
+  T agg = OP_TYPE::identity();
+  for (int i = 0; i < N; ++i) {
+    agg = (i == 0 || keys[i] != keys[i - 1]) ? in[i] : OP_TYPE()(agg, in[i]);
+    ASSERT_EQ(agg, out[i]) << "(at index " << i << ")";
+  }
+}
+
+template <typename EXEC_POLICY, typename OP_TYPE>
+void ScanExclusiveByKeyFunctionalTest(int N, int max_len)
+{
+  using T = typename OP_TYPE::result_type;
+
+  std::vector<int> keys = makeSegmentKeys(N, max_len);
+  std::vector<T> in(N);
+  std::vector<T> ref(N);
+  for (int i = 0; i < N; ++i) {
+    in[i] = static_cast<T>(i % 13);
+  }
+
+  const T init = OP_TYPE::identity();
+  T agg = init;
+  for (int i = 0; i < N; ++i) {
+    if (i == 0 || keys[i] != keys[i - 1]) {
+      agg = init;
+    }
+    ref[i] = agg;
+    agg = OP_TYPE()(agg, in[i]);
+  }
+
+  // in place
+  RAJA::exclusive_scan_by_key<EXEC_POLICY>(keys.begin(),
+                                           keys.end(),
+                                           in.begin(),
+                                           in.begin(),
+                                           OP_TYPE{},
+                                           init);
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(ref[i], in[i]) << "(at index " << i << ")";
+  }
+}
+
+template <typename EXEC_POLICY, typename OP_TYPE>
+void ScanByFlagFunctionalTest(int N, int max_len)
+{
+  using T = typename OP_TYPE::result_type;
+
+  std::vector<int> keys = makeSegmentKeys(N, max_len);
+  std::vector<int> flags(N);
+  std::vector<T> in(N);
+  std::vector<T> by_key(N);
+  std::vector<T> by_flag(N);
+  for (int i = 0; i < N; ++i) {
+    flags[i] = (i > 0 && keys[i] != keys[i - 1]) ? 1 : 0;
+    in[i] = static_cast<T>(i % 13);
+  }
+
+  RAJA::inclusive_scan_by_key<EXEC_POLICY>(
+      keys.begin(), keys.end(), in.begin(), by_key.begin(), OP_TYPE{});
+  RAJA::inclusive_scan_by_flag<EXEC_POLICY>(
+      flags.begin(), flags.end(), in.begin(), by_flag.begin(), OP_TYPE{});
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(by_key[i], by_flag[i]) << "(at index " << i << ")";
+  }
+
+  RAJA::exclusive_scan_by_key<EXEC_POLICY>(
+      keys.begin(), keys.end(), in.begin(), by_key.begin(), OP_TYPE{});
+  RAJA::exclusive_scan_by_flag<EXEC_POLICY>(
+      flags.begin(), flags.end(), in.begin(), by_flag.begin(), OP_TYPE{});
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(by_key[i], by_flag[i]) << "(at index " << i << ")";
+  }
+}
+
+TYPED_TEST_P(ScanSegmentedFunctionalTest, ScanInclusiveByKey)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using OP_TYPE     = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  ScanInclusiveByKeyFunctionalTest<EXEC_POLICY, OP_TYPE>(0, 1);
+  ScanInclusiveByKeyFunctionalTest<EXEC_POLICY, OP_TYPE>(357, 1);
+  ScanInclusiveByKeyFunctionalTest<EXEC_POLICY, OP_TYPE>(32000, 4);
+  ScanInclusiveByKeyFunctionalTest<EXEC_POLICY, OP_TYPE>(32000, 1000);
+  ScanInclusiveByKeyFunctionalTest<EXEC_POLICY, OP_TYPE>(32000, 100000);
+}
+
+TYPED_TEST_P(ScanSegmentedFunctionalTest, ScanExclusiveByKey)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using OP_TYPE     = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  ScanExclusiveByKeyFunctionalTest<EXEC_POLICY, OP_TYPE>(0, 1);
+  ScanExclusiveByKeyFunctionalTest<EXEC_POLICY, OP_TYPE>(357, 1);
+  ScanExclusiveByKeyFunctionalTest<EXEC_POLICY, OP_TYPE>(32000, 4);
+  ScanExclusiveByKeyFunctionalTest<EXEC_POLICY, OP_TYPE>(32000, 1000);
+  ScanExclusiveByKeyFunctionalTest<EXEC_POLICY, OP_TYPE>(32000, 100000);
+}
+
+TYPED_TEST_P(ScanSegmentedFunctionalTest, ScanByFlag)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using OP_TYPE     = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  ScanByFlagFunctionalTest<EXEC_POLICY, OP_TYPE>(357, 3);
+  ScanByFlagFunctionalTest<EXEC_POLICY, OP_TYPE>(32000, 50);
+}
+
+#endif // __TEST_SCAN_SEGMENTED_TESTS_HPP__
@@ -0,0 +1,108 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SCAN_TRANSFORM_TESTS_HPP__
+#define __TEST_SCAN_TRANSFORM_TESTS_HPP__
+
+#include <numeric>
+#include <vector>
+
+// maps i to a value whose running total is exact in every tested type
+template <typename T>
+struct ScanTransformOp {
+  T operator()(const T& value) const { return value % 7 - 3; }
+};
+
+template <>
+struct ScanTransformOp<double> {
+  double operator()(const double& value) const
+  {
+    return static_cast<double>(static_cast<int>(value) % 7 - 3);
+  }
+};
+
+template <typename EXEC_POLICY, typename OP_TYPE>
+void ScanTransformInclusiveFunctionalTest(int N)
+{
+  using T = typename OP_TYPE::result_type;
+
+  std::vector<T> in(N);
+  std::vector<T> out(N);
+  std::iota(in.begin(), in.end(), 1);
+
+  RAJA::transform_inclusive_scan<EXEC_POLICY>(in.begin(),
+                                              in.end(),
+                                              out.begin(),
+                                              ScanTransformOp<T>{},
+                                              OP_TYPE{});
+
+  T agg = OP_TYPE::identity();
+  for (int i = 0; i < N; ++i) {
+    agg = OP_TYPE()(agg, ScanTransformOp<T>{}(in[i]));
+    ASSERT_EQ(agg, out[i]) << "(at index " << i << ")";
+  }
+
+  // in place
+  RAJA::transform_inclusive_scan<EXEC_POLICY>(in.begin(),
+                                              in.end(),
+                                              in.begin(),
+                                              ScanTransformOp<T>{},
+                                              OP_TYPE{});
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(out[i], in[i]) << "(at index " << i << ")";
+  }
+}
+
+template <typename EXEC_POLICY, typename OP_TYPE>
+void ScanTransformExclusiveFunctionalTest(int N)
+{
+  using T = typename OP_TYPE::result_type;
+
+  std::vector<T> in(N);
+  std::vector<T> out(N);
+  std::iota(in.begin(), in.end(), 1);
+
+  const T init = static_cast<T>(11);
+
+  RAJA::transform_exclusive_scan<EXEC_POLICY>(in.begin(),
+                                              in.end(),
+                                              out.begin(),
+                                              ScanTransformOp<T>{},
+                                              OP_TYPE{},
+                                              init);
+
+  T agg = init;
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(agg, out[i]) << "(at index " << i << ")";
+    agg = OP_TYPE()(agg, ScanTransformOp<T>{}(in[i]));
+  }
+}
+
+TYPED_TEST_P(ScanTransformFunctionalTest, ScanTransformInclusive)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using OP_TYPE     = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  ScanTransformInclusiveFunctionalTest<EXEC_POLICY, OP_TYPE>(0);
+  ScanTransformInclusiveFunctionalTest<EXEC_POLICY, OP_TYPE>(1);
+  ScanTransformInclusiveFunctionalTest<EXEC_POLICY, OP_TYPE>(357);
+  ScanTransformInclusiveFunctionalTest<EXEC_POLICY, OP_TYPE>(32000);
+}
+
+TYPED_TEST_P(ScanTransformFunctionalTest, ScanTransformExclusive)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using OP_TYPE     = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  ScanTransformExclusiveFunctionalTest<EXEC_POLICY, OP_TYPE>(0);
+  ScanTransformExclusiveFunctionalTest<EXEC_POLICY, OP_TYPE>(1);
+  ScanTransformExclusiveFunctionalTest<EXEC_POLICY, OP_TYPE>(357);
+  ScanTransformExclusiveFunctionalTest<EXEC_POLICY, OP_TYPE>(32000);
+}
+
+#endif // __TEST_SCAN_TRANSFORM_TESTS_HPP__
@@ -0,0 +1,16 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "test-sort.hpp"
+
+using SequentialSortTypes = 
+  Test<camp::cartesian_product< SequentialForallExecPols,
+                                SortCompareTypes >>::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(Sequential, 
+                               SortFunctionalTest, 
+                               SequentialSortTypes);
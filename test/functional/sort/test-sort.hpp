@@ -0,0 +1,38 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SORT_HPP__
+#define __TEST_SORT_HPP__
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_test-camp.hpp"
+
+#include "RAJA_test-forall-execpol.hpp"
+
+// Sort functional test class
+template<typename T>
+class SortFunctionalTest: public ::testing::Test {};
+
+// Define sort comparison types; integer keys under less and greater are
+// radix sorted, the rest are merge sorted
+using SortCompareTypes = camp::list< RAJA::operators::less<int>,
+                                     RAJA::operators::greater<int>,
+                                     RAJA::operators::less<unsigned long>,
+                                     RAJA::operators::less<double>,
+                                     RAJA::operators::greater<double> >;
+
+TYPED_TEST_SUITE_P(SortFunctionalTest);
+
+#include "tests/test-sort.hpp"
+
+REGISTER_TYPED_TEST_SUITE_P(SortFunctionalTest,
+                            Sort,
+                            StableSort,
+                            SortPairs,
+                            StableSortPairs);
+
+#endif //__TEST_SORT_HPP__
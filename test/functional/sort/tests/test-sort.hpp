@@ -0,0 +1,133 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SORT_TESTS_HPP__
+#define __TEST_SORT_TESTS_HPP__
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+// keys in [0, range) so that there are many equal keys when range is small
+template <typename T>
+std::vector<T> makeSortKeys(int N, int range)
+{
+  std::mt19937 gen(N + range);
+  std::vector<T> keys(N);
+  for (int i = 0; i < N; ++i) {
+    keys[i] = static_cast<T>(gen() % range);
+  }
+  return keys;
+}
+
+// reference stable sort of (key, original position) pairs
+template <typename COMPARE, typename T>
+std::vector<std::pair<T, int>> stableSortReference(const std::vector<T>& keys)
+{
+  std::vector<std::pair<T, int>> ref(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    ref[i] = std::make_pair(keys[i], static_cast<int>(i));
+  }
+  std::stable_sort(ref.begin(),
+                   ref.end(),
+                   [](const std::pair<T, int>& a, const std::pair<T, int>& b) {
+                     return COMPARE()(a.first, b.first);
+                   });
+  return ref;
+}
+
+template <typename EXEC_POLICY, typename COMPARE, bool STABLE>
+void SortFunctionalTestImpl(int N, int range)
+{
+  using T = typename COMPARE::first_argument_type;
+
+  std::vector<T> keys = makeSortKeys<T>(N, range);
+  auto ref = stableSortReference<COMPARE>(keys);
+
+  if (STABLE) {
+    RAJA::stable_sort<EXEC_POLICY>(keys.begin(), keys.end(), COMPARE{});
+  } else {
+    RAJA::sort<EXEC_POLICY>(keys, COMPARE{});
+  }
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(ref[i].first, keys[i]) << "(at index " << i << ")";
+  }
+}
+
+template <typename EXEC_POLICY, typename COMPARE, bool STABLE>
+void SortPairsFunctionalTestImpl(int N, int range)
+{
+  using T = typename COMPARE::first_argument_type;
+
+  std::vector<T> keys = makeSortKeys<T>(N, range);
+  const std::vector<T> orig = keys;
+  std::vector<int> vals(N);
+  for (int i = 0; i < N; ++i) {
+    vals[i] = i;
+  }
+  auto ref = stableSortReference<COMPARE>(keys);
+
+  if (STABLE) {
+    RAJA::stable_sort_pairs<EXEC_POLICY>(keys, vals, COMPARE{});
+  } else {
+    RAJA::sort_pairs<EXEC_POLICY>(
+        keys.data(), keys.data() + N, vals.data(), COMPARE{});
+  }
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(ref[i].first, keys[i]) << "(at index " << i << ")";
+    // every value still travels with its key
+    ASSERT_EQ(orig[vals[i]], keys[i]) << "(at index " << i << ")";
+    if (STABLE) {
+      ASSERT_EQ(ref[i].second, vals[i]) << "(at index " << i << ")";
+    }
+  }
+}
+
+TYPED_TEST_P(SortFunctionalTest, Sort)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using COMPARE     = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  SortFunctionalTestImpl<EXEC_POLICY, COMPARE, false>(0, 10);
+  SortFunctionalTestImpl<EXEC_POLICY, COMPARE, false>(357, 10);
+  SortFunctionalTestImpl<EXEC_POLICY, COMPARE, false>(32000, 1000000);
+}
+
+TYPED_TEST_P(SortFunctionalTest, StableSort)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using COMPARE     = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  SortFunctionalTestImpl<EXEC_POLICY, COMPARE, true>(0, 10);
+  SortFunctionalTestImpl<EXEC_POLICY, COMPARE, true>(357, 10);
+  SortFunctionalTestImpl<EXEC_POLICY, COMPARE, true>(32000, 1000000);
+}
+
+TYPED_TEST_P(SortFunctionalTest, SortPairs)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using COMPARE     = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  SortPairsFunctionalTestImpl<EXEC_POLICY, COMPARE, false>(0, 10);
+  SortPairsFunctionalTestImpl<EXEC_POLICY, COMPARE, false>(357, 10);
+  SortPairsFunctionalTestImpl<EXEC_POLICY, COMPARE, false>(32000, 100);
+}
+
+TYPED_TEST_P(SortFunctionalTest, StableSortPairs)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using COMPARE     = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  SortPairsFunctionalTestImpl<EXEC_POLICY, COMPARE, true>(0, 10);
+  SortPairsFunctionalTestImpl<EXEC_POLICY, COMPARE, true>(357, 10);
+  SortPairsFunctionalTestImpl<EXEC_POLICY, COMPARE, true>(32000, 100);
+}
+
+#endif // __TEST_SORT_TESTS_HPP__
@@ -0,0 +1,35 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TRANSFORM_REDUCE_HPP__
+#define __TEST_TRANSFORM_REDUCE_HPP__
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_test-camp.hpp"
+
+#include "RAJA_test-forall-execpol.hpp"
+
+// Transform-reduce functional test class
+template<typename T>
+class TransformReduceFunctionalTest: public ::testing::Test {};
+
+// Define transform-reduce data types
+using TransformReduceDataTypes = camp::list< int,
+                                             long,
+                                             double >;
+
+TYPED_TEST_SUITE_P(TransformReduceFunctionalTest);
+
+#include "tests/test-transform-reduce.hpp"
+
+REGISTER_TYPED_TEST_SUITE_P(TransformReduceFunctionalTest,
+                            SegmentSum,
+                            MinMax,
+                            DotProduct,
+                            GenericOperator);
+
+#endif //__TEST_TRANSFORM_REDUCE_HPP__
@@ -0,0 +1,153 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TRANSFORM_REDUCE_TESTS_HPP__
+#define __TEST_TRANSFORM_REDUCE_TESTS_HPP__
+
+#include <algorithm>
+#include <vector>
+
+template <typename T>
+std::vector<T> makeTransformReduceData(int N)
+{
+  std::vector<T> data(N);
+  for (int i = 0; i < N; ++i) {
+    data[i] = static_cast<T>((i * 7) % 23) - static_cast<T>(11);
+  }
+  return data;
+}
+
+template <typename EXEC_POLICY, typename T>
+void SegmentSumFunctionalTestImpl(int N)
+{
+  const std::vector<T> data = makeTransformReduceData<T>(N);
+  const T* d = data.data();
+
+  T ref = static_cast<T>(5);
+  for (int i = 0; i < N; ++i) {
+    ref += d[i] * static_cast<T>(2);
+  }
+
+  T sum = RAJA::transform_reduce<EXEC_POLICY>(
+      RAJA::TypedRangeSegment<RAJA::Index_type>(0, N),
+      static_cast<T>(5),
+      RAJA::operators::plus<T>{},
+      [=](RAJA::Index_type i) { return d[i] * static_cast<T>(2); });
+
+  ASSERT_EQ(ref, sum);
+}
+
+template <typename EXEC_POLICY, typename T>
+void MinMaxFunctionalTestImpl(int N)
+{
+  const std::vector<T> data = makeTransformReduceData<T>(N);
+
+  T ref_min = static_cast<T>(100);
+  T ref_max = static_cast<T>(-100);
+  for (int i = 0; i < N; ++i) {
+    ref_min = std::min(ref_min, data[i]);
+    ref_max = std::max(ref_max, data[i]);
+  }
+
+  auto identity = [](T v) { return v; };
+  T min = RAJA::transform_reduce<EXEC_POLICY>(data.begin(),
+                                              data.end(),
+                                              static_cast<T>(100),
+                                              RAJA::operators::minimum<T>{},
+                                              identity);
+  T max = RAJA::transform_reduce<EXEC_POLICY>(data,
+                                              static_cast<T>(-100),
+                                              RAJA::operators::maximum<T>{},
+                                              identity);
+
+  ASSERT_EQ(ref_min, min);
+  ASSERT_EQ(ref_max, max);
+}
+
+template <typename EXEC_POLICY, typename T>
+void DotProductFunctionalTestImpl(int N)
+{
+  const std::vector<T> a = makeTransformReduceData<T>(N);
+  std::vector<T> b(N);
+  for (int i = 0; i < N; ++i) {
+    b[i] = static_cast<T>(i % 3);
+  }
+
+  T ref = static_cast<T>(0);
+  for (int i = 0; i < N; ++i) {
+    ref += a[i] * b[i];
+  }
+
+  T dot = RAJA::transform_reduce<EXEC_POLICY>(
+      a.data(), a.data() + N, b.data(), static_cast<T>(0));
+
+  ASSERT_EQ(ref, dot);
+}
+
+// reduces with an operator that has no OpenMP reduction clause
+template <typename EXEC_POLICY, typename T>
+void GenericOperatorFunctionalTestImpl(int N)
+{
+  const std::vector<T> data = makeTransformReduceData<T>(N);
+
+  // largest magnitude, folded with a lambda operator
+  long ref = 0;
+  for (int i = 0; i < N; ++i) {
+    ref = std::max(ref, static_cast<long>(data[i] < 0 ? -data[i] : data[i]));
+  }
+
+  long mag = RAJA::transform_reduce<EXEC_POLICY>(
+      data.begin(),
+      data.end(),
+      0L,
+      [](long x, long y) { return x > y ? x : y; },
+      [](T v) { return static_cast<long>(v < 0 ? -v : v); });
+
+  ASSERT_EQ(ref, mag);
+}
+
+TYPED_TEST_P(TransformReduceFunctionalTest, SegmentSum)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using DATA_TYPE   = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  SegmentSumFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(0);
+  SegmentSumFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(357);
+  SegmentSumFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(32000);
+}
+
+TYPED_TEST_P(TransformReduceFunctionalTest, MinMax)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using DATA_TYPE   = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  MinMaxFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(0);
+  MinMaxFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(357);
+  MinMaxFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(32000);
+}
+
+TYPED_TEST_P(TransformReduceFunctionalTest, DotProduct)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using DATA_TYPE   = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  DotProductFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(0);
+  DotProductFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(357);
+  DotProductFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(32000);
+}
+
+TYPED_TEST_P(TransformReduceFunctionalTest, GenericOperator)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using DATA_TYPE   = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  GenericOperatorFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(0);
+  GenericOperatorFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(357);
+  GenericOperatorFunctionalTestImpl<EXEC_POLICY, DATA_TYPE>(32000);
+}
+
+#endif // __TEST_TRANSFORM_REDUCE_TESTS_HPP__
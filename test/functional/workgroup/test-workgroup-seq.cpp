@@ -0,0 +1,18 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "test-workgroup.hpp"
+
+// Cartesian product of types for Sequential tests
+using SequentialWorkGroupTypes =
+  Test< camp::cartesian_product<IdxTypeList,
+                                HostResourceList,
+                                SequentialForallExecPols> >::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(Sequential,
+                               WorkGroupTest,
+                               SequentialWorkGroupTypes);
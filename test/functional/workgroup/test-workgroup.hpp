@@ -0,0 +1,29 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_WORKGROUP_HPP__
+#define __TEST_WORKGROUP_HPP__
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_test-camp.hpp"
+#include "RAJA_test-index-types.hpp"
+
+#include "RAJA_test-forall-data.hpp"
+#include "RAJA_test-forall-execpol.hpp"
+
+TYPED_TEST_SUITE_P(WorkGroupTest);
+template <typename T>
+class WorkGroupTest : public ::testing::Test
+{
+};
+
+#include "tests/test-workgroup-rangesegment.hpp"
+
+REGISTER_TYPED_TEST_SUITE_P(WorkGroupTest,
+                            RangeSegmentWorkGroup);
+
+#endif  // __TEST_WORKGROUP_HPP__
@@ -0,0 +1,93 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_WORKGROUP_RANGESEGMENT_HPP__
+#define __TEST_WORKGROUP_RANGESEGMENT_HPP__
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void WorkGroupRangeSegmentTest(INDEX_TYPE num_loops)
+{
+  // loops of uneven lengths, some empty, over disjoint parts of one array
+  std::vector<INDEX_TYPE> loop_begin(num_loops + 1, INDEX_TYPE(0));
+  for (INDEX_TYPE l = INDEX_TYPE(0); l < num_loops; ++l) {
+    loop_begin[l + 1] = loop_begin[l] + INDEX_TYPE((l * 37) % 101);
+  }
+  const INDEX_TYPE N = loop_begin[num_loops];
+
+  camp::resources::Resource working_res{WORKING_RES()};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  allocateForallTestData<INDEX_TYPE>(N,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  for (INDEX_TYPE l = INDEX_TYPE(0); l < num_loops; ++l) {
+    for (INDEX_TYPE i = loop_begin[l]; i < loop_begin[l + 1]; ++i) {
+      test_array[i] = i + l;
+    }
+  }
+
+  RAJA::WorkGroup<EXEC_POLICY, 16> group;
+
+  // refill the group the way a timestep loop would; memory is reused
+  for (int step = 0; step < 3; ++step) {
+    group.clear();
+    working_res.memset(working_array, 0, sizeof(INDEX_TYPE) * N);
+
+    for (INDEX_TYPE l = INDEX_TYPE(0); l < num_loops; ++l) {
+      group.enqueue(
+          RAJA::TypedRangeSegment<INDEX_TYPE>(loop_begin[l], loop_begin[l + 1]),
+          [=](INDEX_TYPE idx) { working_array[idx] += idx + l; });
+    }
+
+    ASSERT_EQ(static_cast<RAJA::Index_type>(N), group.num_iterations());
+
+    group.run();
+
+    working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * N);
+
+    for (INDEX_TYPE i = INDEX_TYPE(0); i < N; i++) {
+      ASSERT_EQ(test_array[i], check_array[i]);
+    }
+  }
+
+  // running again executes every loop again
+  group.run();
+
+  working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * N);
+
+  for (INDEX_TYPE i = INDEX_TYPE(0); i < N; i++) {
+    ASSERT_EQ(INDEX_TYPE(2) * test_array[i], check_array[i]);
+  }
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
+TYPED_TEST_P(WorkGroupTest, RangeSegmentWorkGroup)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  WorkGroupRangeSegmentTest<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(1));
+  WorkGroupRangeSegmentTest<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(10));
+  WorkGroupRangeSegmentTest<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(200));
+
+  // an empty group runs nothing
+  RAJA::WorkGroup<EXEC_POLICY> group;
+  group.run();
+  ASSERT_EQ(size_t(0), group.num_loops());
+}
+
+#endif  // __TEST_WORKGROUP_RANGESEGMENT_HPP__
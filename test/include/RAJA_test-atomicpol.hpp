@@ -28,6 +28,17 @@ using OpenMPAtomicPols =
             >;
 #endif  // RAJA_ENABLE_OPENMP
 
+#if defined(RAJA_ENABLE_THREADS)
+using ThreadsAtomicPols =
+  camp::list<
+#if defined(RAJA_TEST_EXHAUSTIVE)
+              RAJA::builtin_atomic,
+#endif
+              RAJA::threads_atomic,
+              RAJA::auto_atomic
+            >;
+#endif  // RAJA_ENABLE_THREADS
+
 #if defined(RAJA_ENABLE_CUDA)
 using CudaAtomicPols =
   camp::list<
@@ -38,6 +38,13 @@ using OpenMPForallExecPols =
               // since its usage is questionable
               // RAJA::omp_parallel_exec<RAJA::seq_exec>,
               RAJA::omp_parallel_for_exec, 
+              RAJA::omp_parallel_for_dynamic<2>,
+              RAJA::omp_parallel_for_guided<>,
+              RAJA::omp_parallel_for_runtime,
+              RAJA::omp_taskloop_exec<>,
+              RAJA::omp_taskloop_exec<16>,
+              RAJA::omp_affinity_static_exec<>,
+              RAJA::omp_affinity_static_exec<4, true>,
               RAJA::omp_for_nowait_exec,
               RAJA::omp_for_exec >;
 
@@ -51,6 +58,24 @@ using OpenMPForallAtomicExecPols =
 #endif
               RAJA::omp_for_exec >;
 
+// OpenMP policies supported by RAJA::forall_chunked
+using OpenMPForallChunkedExecPols =
+  camp::list< RAJA::omp_parallel_for_exec,
+              RAJA::omp_parallel_for_static<8>,
+              RAJA::omp_parallel_for_dynamic<>,
+              RAJA::omp_parallel_for_dynamic<2>,
+              RAJA::omp_affinity_static_exec<4>,
+              RAJA::omp_for_nowait_exec,
+              RAJA::omp_for_exec >;
+
+// OpenMP policies supported by RAJA::forall_param
+using OpenMPForallParamExecPols =
+  camp::list< RAJA::omp_parallel_for_exec,
+              RAJA::omp_parallel_for_static<8>,
+              RAJA::omp_parallel_for_dynamic<2>,
+              RAJA::omp_parallel_for_guided<>,
+              RAJA::omp_parallel_for_runtime >;
+
 #endif
 
 #if defined(RAJA_ENABLE_TBB)
@@ -62,6 +87,20 @@ using TBBForallExecPols = camp::list< RAJA::tbb_for_exec,
                                       RAJA::tbb_for_dynamic >;
 #endif
 
+#if defined(RAJA_ENABLE_THREADS)
+using ThreadsForallExecPols = camp::list< RAJA::threads_for_exec,
+                                          RAJA::threads_for_dynamic< 1 >,
+                                          RAJA::threads_for_dynamic< 16 >,
+                                          RAJA::threads_for_static >;
+
+using ThreadsForallAtomicExecPols =
+  camp::list<
+#if defined(RAJA_TEST_EXHAUSTIVE)
+              RAJA::threads_for_static,
+#endif
+              RAJA::threads_for_exec >;
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 using OpenMPTargetForallExecPols =
   camp::list< RAJA::omp_target_parallel_for_exec<8>,
@@ -24,9 +24,18 @@ using OpenMPForallIndexSetExecPols =
               RAJA::ExecPolicy<RAJA::omp_parallel_segit, RAJA::seq_exec>,
               RAJA::ExecPolicy<RAJA::omp_parallel_segit, RAJA::loop_exec>,
               RAJA::ExecPolicy<RAJA::omp_parallel_segit, RAJA::simd_exec>,
+              RAJA::ExecPolicy<RAJA::omp_parallel_for_dynamic_segit, RAJA::seq_exec>,
+              RAJA::ExecPolicy<RAJA::omp_parallel_for_guided_segit, RAJA::loop_exec>,
               RAJA::ExecPolicy<RAJA::seq_segit, RAJA::omp_for_exec>,
               RAJA::ExecPolicy<RAJA::seq_segit, RAJA::omp_parallel_for_exec>,
               RAJA::ExecPolicy<RAJA::seq_segit, RAJA::omp_for_nowait_exec> >;
+
+// Index sets iterated with these must have a segment dependency graph
+using OpenMPTaskgraphIndexSetExecPols =
+  camp::list< RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>,
+              RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::loop_exec>,
+              RAJA::ExecPolicy<RAJA::omp_taskgraph_interval_segit, 
+                               RAJA::seq_exec> >;
 #endif
 
 #if defined(RAJA_ENABLE_TBB)
@@ -45,6 +54,16 @@ using TBBForallIndexSetExecPols =
               RAJA::ExecPolicy<RAJA::seq_segit, RAJA::tbb_for_dynamic> >;
 #endif
 
+#if defined(RAJA_ENABLE_THREADS)
+using ThreadsForallIndexSetExecPols =
+  camp::list< RAJA::ExecPolicy<RAJA::threads_segit, RAJA::seq_exec>,
+              RAJA::ExecPolicy<RAJA::threads_segit, RAJA::loop_exec>,
+              RAJA::ExecPolicy<RAJA::threads_segit, RAJA::simd_exec>,
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::threads_for_exec>,
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::threads_for_dynamic< 4 >>,
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::threads_for_static> >;
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 using OpenMPTargetForallIndexSetExecPols =
   camp::list< RAJA::ExecPolicy<RAJA::seq_segit,
@@ -15,7 +15,11 @@
 #include "RAJA/RAJA.hpp"
 
 // Sequential reduction policy types
-using SequentialReducePols = camp::list< RAJA::seq_reduce >;
+using SequentialReducePols = camp::list< RAJA::seq_reduce,
+                                         RAJA::seq_reduce_reproducible >;
+
+using SequentialReproducibleReducePols =
+  camp::list< RAJA::seq_reduce_reproducible >;
 
 #if defined(RAJA_ENABLE_OPENMP)
 using OpenMPReducePols = 
@@ -23,12 +27,28 @@ using OpenMPReducePols =
   camp::list< RAJA::omp_reduce,
               RAJA::omp_reduce_ordered >;
 #else
-  camp::list< RAJA::omp_reduce >;
+  camp::list< RAJA::omp_reduce,
+              RAJA::omp_reduce_reproducible >;
 #endif
+
+using OpenMPReproducibleReducePols =
+  camp::list< RAJA::omp_reduce_reproducible >;
 #endif
 
 #if defined(RAJA_ENABLE_TBB)
-using TBBReducePols = camp::list< RAJA::tbb_reduce >;
+using TBBReducePols = camp::list< RAJA::tbb_reduce,
+                                  RAJA::tbb_reduce_reproducible >;
+
+using TBBReproducibleReducePols =
+  camp::list< RAJA::tbb_reduce_reproducible >;
+#endif
+
+#if defined(RAJA_ENABLE_THREADS)
+using ThreadsReducePols = camp::list< RAJA::threads_reduce,
+                                      RAJA::threads_reduce_reproducible >;
+
+using ThreadsReproducibleReducePols =
+  camp::list< RAJA::threads_reduce_reproducible >;
 #endif
 
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
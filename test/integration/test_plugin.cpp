@@ -9,6 +9,8 @@
 
 #include "gtest/gtest.h"
 
+#include <atomic>
+
 int plugin_test_counter_pre{0};
 int plugin_test_counter_post{0};
 
@@ -31,3 +33,39 @@ TEST(PluginTest, Counter)
 
   delete[] a;
 }
+
+// Check that an asynchronous launch runs the post-launch plugins when the
+// loop completes, not when it is launched
+TEST(PluginTest, CounterAsync)
+{
+  int pre = plugin_test_counter_pre;
+  int post = plugin_test_counter_post;
+
+#if defined(RAJA_ENABLE_THREADS)
+  std::atomic<bool> go{false};
+  std::atomic<bool>* go_ptr = &go;
+
+  RAJA::AsyncEvent event = RAJA::forall_async<RAJA::threads_for_exec>(
+    RAJA::RangeSegment(0,10),
+    [=] (int) {
+      while (!go_ptr->load()) {
+      }
+  });
+
+  ASSERT_EQ(plugin_test_counter_pre, pre + 1);
+  ASSERT_EQ(plugin_test_counter_post, post);
+
+  go = true;
+#else
+  RAJA::AsyncEvent event = RAJA::forall_async<RAJA::seq_exec>(
+    RAJA::RangeSegment(0,10),
+    [=] (int) {
+  });
+#endif
+
+  event.wait();
+  event.wait();
+
+  ASSERT_EQ(plugin_test_counter_pre, pre + 1);
+  ASSERT_EQ(plugin_test_counter_post, post + 1);
+}
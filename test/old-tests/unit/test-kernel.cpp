@@ -442,6 +442,15 @@ using OMPTypes = ::testing::Types<
                              RAJA::omp_parallel_for_exec,
                              For<1, RAJA::loop_exec, For<0, s, Lambda<0>>>>>,
          list<TypedIndex, Index_type>,
+         RAJA::omp_reduce>,
+    list<KernelPolicy<
+             For<1, RAJA::omp_taskloop_exec<>, For<0, s, Lambda<0>>>>,
+         list<TypedIndex, Index_type>,
+         RAJA::omp_reduce>,
+    list<KernelPolicy<statement::Collapse<RAJA::omp_taskloop_collapse_exec<4>,
+                                          ArgList<0, 1>,
+                                          Lambda<0>>>,
+         list<Index_type, Index_type>,
          RAJA::omp_reduce>>;
 INSTANTIATE_TYPED_TEST_SUITE_P(OpenMP, Kernel, OMPTypes);
 #endif
@@ -1424,6 +1433,88 @@ TEST(Kernel, Collapse3)
   delete[] data;
 }
 
+TEST(Kernel, Collapse2Scheduled)
+{
+  int N = 16;
+  int M = 7;
+
+  int *data = new int[N * M];
+  for (int i = 0; i < M * N; ++i) {
+    data[i] = -1;
+  }
+
+  using DynamicPol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::omp_parallel_collapse_dynamic_exec<3>,
+                                ArgList<0, 1>,
+                                Lambda<0>>>;
+
+  RAJA::kernel<DynamicPol>(RAJA::make_tuple(RAJA::RangeSegment(0, N),
+                                            RAJA::RangeSegment(0, M)),
+                           [=](Index_type i, Index_type j) {
+                             data[i + j * N] = i;
+                           });
+
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < M; ++j) {
+      ASSERT_EQ(data[i + j * N], i);
+    }
+  }
+
+  using RuntimePol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::omp_parallel_collapse_runtime_exec,
+                                ArgList<0, 1>,
+                                Lambda<0>>>;
+
+  RAJA::kernel<RuntimePol>(RAJA::make_tuple(RAJA::RangeSegment(0, N),
+                                            RAJA::RangeSegment(0, M)),
+                           [=](Index_type i, Index_type j) {
+                             data[i + j * N] = j;
+                           });
+
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < M; ++j) {
+      ASSERT_EQ(data[i + j * N], j);
+    }
+  }
+
+  delete[] data;
+}
+
+TEST(Kernel, Collapse3Guided)
+{
+  int N = 3;
+  int M = 4;
+  int K = 5;
+
+  int *data = new int[N * M * K];
+  for (int i = 0; i < M * N * K; ++i) {
+    data[i] = -1;
+  }
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::omp_parallel_collapse_guided_exec<>,
+                                ArgList<0, 1, 2>,
+                                Lambda<0>>>;
+
+  RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, K),
+                                     RAJA::RangeSegment(0, M),
+                                     RAJA::RangeSegment(0, N)),
+                    [=](Index_type k, Index_type j, Index_type i) {
+                      data[i + N * (j + M * k)] = i + N * (j + M * k);
+                    });
+
+  for (int k = 0; k < K; k++) {
+    for (int j = 0; j < M; ++j) {
+      for (int i = 0; i < N; ++i) {
+        int id = i + N * (j + M * k);
+        ASSERT_EQ(data[id], id);
+      }
+    }
+  }
+
+  delete[] data;
+}
+
 TEST(Kernel, Collapse4)
 {
   int N = 1;
@@ -9,7 +9,11 @@
 /// Source file containing tests for basic multipolicy operation
 ///
 
+#include <chrono>
 #include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <thread>
 #include "gtest/gtest.h"
 
 // Tag type to dispatch to test bodies based on policy selected by multipolicy
@@ -50,8 +54,21 @@ void forall_impl(const mp_tag<i> &p, Iterable &&iter, mp_test_body const &body)
 {
   body(p, iter.size());
 }
+
+// fake policies for the autotune tests; policy 0 is always the slowest
+template <int i>
+struct at_tag {
+};
+
+template <int i, typename Iterable, typename Body>
+void forall_impl(const at_tag<i> &, Iterable &&, Body &&body)
+{
+  if (i == 0) std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  body(i);
+}
 }  // namespace test_policy
 
+using test_policy::at_tag;
 using test_policy::mp_tag;
 
 // NOTE: this *must* be after the above to work
@@ -101,3 +118,95 @@ TEST(MultiPolicy, invalid_index)
       });
   ASSERT_THROW(make_invalid_index_throw(mp, seg), std::runtime_error);
 }
+
+TEST(AutotunePolicy, tuning)
+{
+  auto at = RAJA::make_autotune_policy<at_tag<0>, at_tag<1>, at_tag<2>>(
+      "autotune-tuning", 2);
+  int used[3] = {0, 0, 0};
+  auto body = [&](int p) { used[p]++; };
+
+  // every candidate is timed twice, then the fastest is kept
+  for (int call = 0; call < 6; ++call) {
+    RAJA::forall(at, RAJA::RangeSegment(0, 10), body);
+  }
+  ASSERT_EQ(2, used[0]);
+  ASSERT_EQ(2, used[1]);
+  ASSERT_EQ(2, used[2]);
+
+  for (int call = 0; call < 5; ++call) {
+    RAJA::forall(at, RAJA::RangeSegment(0, 12), body);
+  }
+  ASSERT_EQ(2, used[0]);
+  ASSERT_EQ(7, used[1] + used[2]);
+
+  // a different size bucket is tuned separately
+  RAJA::forall(at, RAJA::RangeSegment(0, 1000), body);
+  ASSERT_EQ(3, used[0]);
+
+  int decided = 0;
+  for (const auto &stats :
+       RAJA::AutotuneRegistry::getInstance().statistics()) {
+    if (stats.name != "autotune-tuning") continue;
+    ASSERT_EQ(3u, stats.calls.size());
+    if (stats.choice >= 0) {
+      ASSERT_NE(0, stats.choice);
+      ++decided;
+    }
+  }
+  ASSERT_EQ(1, decided);
+}
+
+TEST(AutotunePolicy, save_load)
+{
+  auto at = RAJA::make_autotune_policy<at_tag<0>, at_tag<1>>(
+      "autotune-save-load", 1);
+  int used[2] = {0, 0};
+  auto body = [&](int p) { used[p]++; };
+
+  RAJA::forall(at, RAJA::RangeSegment(0, 100), body);
+  RAJA::forall(at, RAJA::RangeSegment(0, 100), body);
+
+  auto &registry = RAJA::AutotuneRegistry::getInstance();
+  const std::string filename = "test-autotune-decisions.txt";
+  registry.save(filename);
+
+  // after a reset the loop is tuned again, unless the decisions are loaded
+  registry.reset();
+  registry.load(filename);
+  std::remove(filename.c_str());
+
+  used[0] = used[1] = 0;
+  RAJA::forall(at, RAJA::RangeSegment(0, 100), body);
+  ASSERT_EQ(0, used[0]);
+  ASSERT_EQ(1, used[1]);
+
+  ASSERT_THROW(registry.load("no-such-autotune-file.txt"), std::runtime_error);
+}
+
+TEST(AutotunePolicy, load_other_candidates)
+{
+  auto &registry = RAJA::AutotuneRegistry::getInstance();
+  const std::string filename = "test-autotune-other-candidates.txt";
+  {
+    // policy 1 of two candidates, for loops of 64 to 127 iterations
+    std::ofstream out(filename);
+    out << "# RAJA autotune 1\n"
+        << "6 1 2 autotune-other-candidates\n";
+  }
+  registry.load(filename);
+  std::remove(filename.c_str());
+
+  // three candidates do not match the loaded decision, so it is tuned again
+  auto at = RAJA::make_autotune_policy<at_tag<0>, at_tag<1>, at_tag<2>>(
+      "autotune-other-candidates", 1);
+  int used[3] = {0, 0, 0};
+  auto body = [&](int p) { used[p]++; };
+
+  for (int call = 0; call < 3; ++call) {
+    RAJA::forall(at, RAJA::RangeSegment(0, 100), body);
+  }
+  ASSERT_EQ(1, used[0]);
+  ASSERT_EQ(1, used[1]);
+  ASSERT_EQ(1, used[2]);
+}
@@ -98,6 +98,61 @@ TEST(IndexSetUnitTest, Swap)
   ASSERT_EQ(size_t(0), iset1.getLength());
 }
 
+TEST(IndexSetUnitTest, DependencyGraph)
+{
+  using RangeSegType = RAJA::TypedRangeSegment<int>;
+  using RIndexSetType = RAJA::TypedIndexSet<RangeSegType>;
+  RIndexSetType iset;
+  for (int i = 0; i < 12; ++i) {
+    iset.push_back(RangeSegType(i * 10, (i + 1) * 10));
+  }
+  ASSERT_FALSE(iset.dependencyGraphSet());
+
+  // more dependents than the old fixed per-node limit of 8
+  for (int i = 1; i < 12; ++i) {
+    iset.addSegmentDependency(0, i);
+  }
+  iset.addSegmentDependency(1, 11);
+  ASSERT_TRUE(iset.dependencyGraphSet());
+
+  ASSERT_EQ(11, iset.getDepGraphNode(0).numDepTasks());
+  ASSERT_EQ(11, iset.getDepGraphNode(0).depTaskNum(10));
+  ASSERT_EQ(0, iset.getDepGraphNode(0).semaphoreReloadValue());
+  ASSERT_EQ(2, iset.getDepGraphNode(11).semaphoreReloadValue());
+  ASSERT_EQ(2, iset.getDepGraphNode(11).semaphoreValue());
+
+  ASSERT_FALSE(iset.getDepGraphNode(11).satisfyOne());
+  ASSERT_FALSE(iset.getDepGraphNode(11).ready());
+  ASSERT_TRUE(iset.getDepGraphNode(11).satisfyOne());
+  ASSERT_TRUE(iset.getDepGraphNode(11).ready());
+  iset.getDepGraphNode(11).reset();
+  ASSERT_FALSE(iset.getDepGraphNode(11).ready());
+
+  // copies share the graph until one of them changes it
+  RIndexSetType iset2(iset);
+  ASSERT_TRUE(iset2.dependencyGraphSet());
+  ASSERT_EQ(&iset.getDepGraphNode(0), &iset2.getDepGraphNode(0));
+  iset2.addSegmentDependency(2, 3);
+  ASSERT_EQ(12, iset2.getDepGraphNode(0).numDepTasks() +
+                    iset2.getDepGraphNode(2).numDepTasks());
+  ASSERT_EQ(0, iset.getDepGraphNode(2).numDepTasks());
+  ASSERT_EQ(2, iset2.getDepGraphNode(3).semaphoreReloadValue());
+  ASSERT_EQ(1, iset.getDepGraphNode(3).semaphoreReloadValue());
+
+  // adding a segment leaves the graph unset until a dependency covers it
+  iset.push_back(RangeSegType(120, 130));
+  ASSERT_FALSE(iset.dependencyGraphSet());
+  iset.addSegmentDependency(11, 12);
+  ASSERT_TRUE(iset.dependencyGraphSet());
+  ASSERT_EQ(11, iset.getDepGraphNode(0).numDepTasks());
+  ASSERT_EQ(2, iset.getDepGraphNode(11).semaphoreReloadValue());
+  ASSERT_EQ(1, iset.getDepGraphNode(12).semaphoreReloadValue());
+
+  iset.initDependencyGraph();
+  ASSERT_TRUE(iset.dependencyGraphSet());
+  ASSERT_EQ(0, iset.getDepGraphNode(0).numDepTasks());
+}
+
 TEST(IndexSetUnitTest, Slice)
 {
   using RangeSegType = RAJA::TypedRangeSegment<int>;
@@ -0,0 +1,118 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for PrefetchListSegment and
+/// prefetch_exec
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA_unit-test-types.hpp"
+
+#include <vector>
+
+template<typename T>
+class PrefetchSegmentUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(PrefetchSegmentUnitTest, UnitIndexTypes);
+
+template <typename IdxT>
+std::vector<IdxT> scatteredIndices(IdxT n)
+{
+  // a permutation of [0, n) when n is not a multiple of 7
+  std::vector<IdxT> idx;
+  for (IdxT i = 0; i < n; ++i) {
+    idx.push_back(static_cast<IdxT>((i * 7) % n));
+  }
+  return idx;
+}
+
+TYPED_TEST(PrefetchSegmentUnitTest, Iteration)
+{
+  const TypeParam n = 50;
+  std::vector<TypeParam> idx = scatteredIndices(n);
+  std::vector<double> x(n, 1.0);
+
+  RAJA::TypedListSegment<TypeParam> list(&idx[0], idx.size(), RAJA::Unowned);
+  auto seg = RAJA::make_prefetch_segment(list, x.data());
+
+  ASSERT_EQ(list.size(), seg.size());
+  ASSERT_EQ(seg.end() - seg.begin(), seg.size());
+  for (RAJA::Index_type i = 0; i < seg.size(); ++i) {
+    ASSERT_EQ(idx[i], seg.begin()[i]);
+    seg.prefetch(i);
+  }
+}
+
+template <typename IdxT, typename ExecPolicy>
+void PrefetchForallTest(IdxT n)
+{
+  std::vector<IdxT> idx = scatteredIndices(n);
+  std::vector<double> x(n), y(n), z(n, 0.0);
+  for (IdxT i = 0; i < n; ++i) {
+    x[i] = static_cast<double>(i);
+    y[i] = 2.0;
+  }
+
+  RAJA::TypedListSegment<IdxT> list(&idx[0], idx.size(), RAJA::Unowned);
+  const double* x_ptr = x.data();
+  const double* y_ptr = y.data();
+  double* z_ptr = z.data();
+
+  RAJA::forall<ExecPolicy>(
+      RAJA::make_prefetch_segment(list, x_ptr, y_ptr),
+      [=](IdxT i) { z_ptr[i] += x_ptr[i] * y_ptr[i]; });
+
+  for (IdxT i = 0; i < n; ++i) {
+    ASSERT_EQ(2.0 * static_cast<double>(i), z[i]);
+  }
+}
+
+TYPED_TEST(PrefetchSegmentUnitTest, Forall)
+{
+  using seq_pol = RAJA::prefetch_exec<RAJA::seq_exec>;
+  using loop_pol = RAJA::prefetch_exec<RAJA::loop_exec, 2>;
+
+  PrefetchForallTest<TypeParam, seq_pol>(TypeParam(1));
+  PrefetchForallTest<TypeParam, seq_pol>(TypeParam(100));
+  PrefetchForallTest<TypeParam, loop_pol>(TypeParam(100));
+  // plain policies iterate the indices without prefetching
+  PrefetchForallTest<TypeParam, RAJA::seq_exec>(TypeParam(100));
+#if defined(RAJA_ENABLE_OPENMP)
+  PrefetchForallTest<TypeParam,
+                     RAJA::prefetch_exec<RAJA::omp_parallel_for_exec>>(
+      TypeParam(100));
+#endif
+#if defined(RAJA_ENABLE_TBB)
+  PrefetchForallTest<TypeParam, RAJA::prefetch_exec<RAJA::tbb_for_dynamic>>(
+      TypeParam(100));
+#endif
+}
+
+TEST(PrefetchSegmentUnitTest, Autotune)
+{
+  const int n = 1000;
+  std::vector<int> idx = scatteredIndices(n);
+  std::vector<double> x(n, 1.0), z(n, 0.0);
+
+  RAJA::TypedListSegment<int> list(&idx[0], idx.size(), RAJA::Unowned);
+  auto pol = RAJA::make_prefetch_autotune_policy<RAJA::seq_exec>(
+      "test-prefetch-segment", 1);
+
+  const double* x_ptr = x.data();
+  double* z_ptr = z.data();
+  for (int rep = 0; rep < 8; ++rep) {
+    RAJA::forall(pol,
+                 RAJA::make_prefetch_segment(list, x_ptr),
+                 [=](int i) { z_ptr[i] += x_ptr[i]; });
+  }
+
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(8.0, z[i]);
+  }
+}
@@ -0,0 +1,77 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for omp_affinity_static_exec and
+/// omp_affinity_allocate
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+TEST(AffinityUnitTest, StableMapping)
+{
+  using policy = RAJA::omp_affinity_static_exec<8>;
+  const RAJA::Index_type N = 1000;
+
+  std::vector<int> owner(N, -1);
+  int* owner_ptr = owner.data();
+
+  RAJA::forall<policy>(RAJA::RangeSegment(0, N), [=](RAJA::Index_type i) {
+    owner_ptr[i] = omp_get_thread_num();
+  });
+
+  // loops over sub-ranges run each index on the thread that owned it above
+  std::vector<int> mismatch(N, 0);
+  int* mismatch_ptr = mismatch.data();
+
+  RAJA::forall<policy>(RAJA::RangeSegment(13, N - 7), [=](RAJA::Index_type i) {
+    mismatch_ptr[i] += owner_ptr[i] != omp_get_thread_num();
+  });
+  RAJA::forall<policy>(RAJA::RangeSegment(500, 501), [=](RAJA::Index_type i) {
+    mismatch_ptr[i] += owner_ptr[i] != omp_get_thread_num();
+  });
+
+  const int num_threads = omp_get_max_threads();
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ((i / 8) % num_threads, owner[i]);
+    ASSERT_EQ(0, mismatch[i]);
+  }
+}
+
+TEST(AffinityUnitTest, Allocate)
+{
+  const size_t N = 10007;
+
+  double* a = RAJA::omp_affinity_allocate<double>(N);
+  ASSERT_NE(nullptr, a);
+  ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(a) % RAJA::affinity_alignment);
+
+  for (size_t i = 0; i < N; ++i) {
+    ASSERT_EQ(0.0, a[i]);
+  }
+
+  RAJA::omp_affinity_free(a);
+
+  int* b = RAJA::omp_affinity_allocate<int, RAJA::omp_parallel_for_exec>(3);
+  ASSERT_EQ(0, b[2]);
+  RAJA::omp_affinity_free(b);
+}
+
+TEST(AffinityUnitTest, Allocator)
+{
+  std::vector<int, RAJA::omp_affinity_allocator<int>> v(5000, 3);
+
+  int* v_ptr = v.data();
+  RAJA::ReduceSum<RAJA::omp_reduce, long> sum(0);
+  RAJA::forall<RAJA::omp_affinity_static_exec<>>(
+      RAJA::RangeSegment(0, 5000),
+      [=](RAJA::Index_type i) { sum += v_ptr[i]; });
+
+  ASSERT_EQ(15000, sum.get());
+}
@@ -0,0 +1,34 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA reducer constructors and initialization.
+///
+
+#include "tests/test-reducer-constructors.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+using ThreadsBasicReducerConstructorTypes = 
+  Test< camp::cartesian_product< ThreadsReducerPolicyList,
+                                 DataTypeList,
+                                 HostResourceList > >::Types;
+
+using ThreadsInitReducerConstructorTypes = 
+  Test< camp::cartesian_product< ThreadsReducerPolicyList,
+                                 DataTypeList,
+                                 HostResourceList,
+                                 SequentialForoneList > >::Types;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(ThreadsBasicTest,
+                               ReducerBasicConstructorUnitTest,
+                               ThreadsBasicReducerConstructorTypes);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(ThreadsInitTest,
+                               ReducerInitConstructorUnitTest,
+                               ThreadsInitReducerConstructorTypes);
+#endif
+
@@ -0,0 +1,25 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA reducer reset.
+///
+
+#include "tests/test-reducer-reset.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+using ThreadsReducerResetTypes = 
+  Test< camp::cartesian_product< ThreadsReducerPolicyList,
+                                 DataTypeList,
+                                 HostResourceList,
+                                 SequentialForoneList > >::Types;
+
+
+INSTANTIATE_TYPED_TEST_SUITE_P(ThreadsResetTest,
+                               ReducerResetUnitTest,
+                               ThreadsReducerResetTypes);
+#endif
@@ -20,15 +20,23 @@ using DataTypeList = camp::list< int,
                                  float,
                                  double >;
 
-using SequentialReducerPolicyList = camp::list< RAJA::seq_reduce >;
+using SequentialReducerPolicyList = camp::list< RAJA::seq_reduce,
+                                                RAJA::seq_reduce_reproducible >;
 
 #if defined(RAJA_ENABLE_TBB)
-using TBBReducerPolicyList = camp::list< RAJA::tbb_reduce >;
+using TBBReducerPolicyList = camp::list< RAJA::tbb_reduce,
+                                         RAJA::tbb_reduce_reproducible >;
+#endif
+
+#if defined(RAJA_ENABLE_THREADS)
+using ThreadsReducerPolicyList = camp::list< RAJA::threads_reduce,
+                                             RAJA::threads_reduce_reproducible >;
 #endif
 
 #if defined(RAJA_ENABLE_OPENMP)
 using OpenMPReducerPolicyList = camp::list< RAJA::omp_reduce,
-                                            RAJA::omp_reduce_ordered >;
+                                            RAJA::omp_reduce_ordered,
+                                            RAJA::omp_reduce_reproducible >;
 #endif
 
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
@@ -0,0 +1,118 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for runtime_exec
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+namespace
+{
+
+void checkForall(const RAJA::runtime_exec& pol)
+{
+  const int N = 1000;
+  std::vector<int> a(N, 0);
+  int* a_ptr = a.data();
+
+  RAJA::forall(pol, RAJA::RangeSegment(0, N), [=](RAJA::Index_type i) {
+    a_ptr[i] += static_cast<int>(i);
+  });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(i, a[i]);
+  }
+
+#if defined(RAJA_ENABLE_OPENMP)
+  // omp_reduce is valid whichever policy is selected
+  RAJA::ReduceSum<RAJA::omp_reduce, long> sum(0);
+
+  RAJA::forall(pol, RAJA::RangeSegment(0, N), [=](RAJA::Index_type i) {
+    sum += a_ptr[i];
+  });
+
+  ASSERT_EQ(static_cast<long>(N) * (N - 1) / 2, sum.get());
+#endif
+}
+
+}  // namespace
+
+TEST(RuntimePolicyTest, Names)
+{
+  for (auto p : {RAJA::RuntimePolicy::seq_exec,
+                 RAJA::RuntimePolicy::loop_exec,
+                 RAJA::RuntimePolicy::simd_exec,
+                 RAJA::RuntimePolicy::omp_parallel_for_exec,
+                 RAJA::RuntimePolicy::tbb_for_dynamic,
+                 RAJA::RuntimePolicy::threads_for_dynamic}) {
+    ASSERT_EQ(p, RAJA::runtime_policy_from_string(RAJA::to_string(p)));
+  }
+  ASSERT_TRUE(RAJA::runtime_policy_available(RAJA::RuntimePolicy::seq_exec));
+  ASSERT_THROW(RAJA::runtime_policy_from_string("no_such_exec"),
+               std::runtime_error);
+}
+
+TEST(RuntimePolicyTest, Forall)
+{
+  for (auto p : {RAJA::RuntimePolicy::seq_exec,
+                 RAJA::RuntimePolicy::loop_exec,
+                 RAJA::RuntimePolicy::simd_exec,
+                 RAJA::RuntimePolicy::omp_parallel_for_exec,
+                 RAJA::RuntimePolicy::tbb_for_dynamic,
+                 RAJA::RuntimePolicy::threads_for_dynamic}) {
+    if (!RAJA::runtime_policy_available(p)) {
+      ASSERT_THROW(RAJA::set_runtime_policy("test-forall", p),
+                   std::runtime_error);
+      continue;
+    }
+    RAJA::set_runtime_policy("test-forall", p);
+    ASSERT_EQ(p, RAJA::get_runtime_policy("test-forall"));
+    checkForall(RAJA::runtime_exec("test-forall"));
+  }
+}
+
+TEST(RuntimePolicyTest, Config)
+{
+  const RAJA::RuntimePolicy saved_default = RAJA::get_runtime_policy();
+
+  const char* filename = "test-runtime-policy.cfg";
+  {
+    std::ofstream cfg(filename);
+    cfg << "# policies for the config test\n"
+        << "\n"
+        << "default loop_exec\n"
+        << "test-config-a seq_exec\n"
+        << "test-config-b simd_exec\n";
+  }
+  RAJA::load_runtime_policy_config(filename);
+  std::remove(filename);
+
+  // loops without an entry of their own follow the default policy
+  ASSERT_EQ(RAJA::RuntimePolicy::loop_exec, RAJA::get_runtime_policy());
+  ASSERT_EQ(RAJA::RuntimePolicy::seq_exec,
+            RAJA::get_runtime_policy("test-config-a"));
+  ASSERT_EQ(RAJA::RuntimePolicy::simd_exec,
+            RAJA::get_runtime_policy("test-config-b"));
+  ASSERT_EQ(RAJA::RuntimePolicy::loop_exec,
+            RAJA::get_runtime_policy("test-config-c"));
+
+  // an existing runtime_exec sees later changes
+  const RAJA::runtime_exec pol_c("test-config-c");
+  RAJA::set_runtime_policy(RAJA::RuntimePolicy::seq_exec);
+  ASSERT_EQ(RAJA::RuntimePolicy::seq_exec, pol_c.get());
+  checkForall(pol_c);
+
+  ASSERT_THROW(RAJA::load_runtime_policy_config("no-such-file.cfg"),
+               std::runtime_error);
+
+  RAJA::set_runtime_policy(saved_default);
+}
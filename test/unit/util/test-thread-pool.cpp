@@ -0,0 +1,54 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the threads back-end pool
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <atomic>
+#include <stdexcept>
+
+TEST(ThreadPoolTest, ExceptionReachesLauncher)
+{
+  auto& pool = RAJA::threads::ThreadPool::getInstance();
+  const RAJA::Index_type N = 10000;
+
+  ASSERT_THROW(pool.parallelFor(N,
+                                16,
+                                [](RAJA::Index_type begin,
+                                   RAJA::Index_type end) {
+                                  if (begin <= 5000 && 5000 < end) {
+                                    throw std::runtime_error("thrown");
+                                  }
+                                }),
+               std::runtime_error);
+
+  ASSERT_THROW(RAJA::forall<RAJA::threads_for_exec>(
+                   RAJA::RangeSegment(0, N),
+                   [](RAJA::Index_type i) {
+                     if (i == 5000) throw std::runtime_error("thrown");
+                   }),
+               std::runtime_error);
+
+  RAJA::AsyncEvent event = pool.parallelForAsync(
+      N, 16, [](RAJA::Index_type begin, RAJA::Index_type end) {
+        if (begin <= 5000 && 5000 < end) {
+          throw std::runtime_error("thrown");
+        }
+      });
+  ASSERT_THROW(event.wait(), std::runtime_error);
+
+  // the pool is still usable afterwards
+  std::atomic<RAJA::Index_type> count{0};
+  std::atomic<RAJA::Index_type>* count_ptr = &count;
+  pool.parallelFor(N, 16, [=](RAJA::Index_type begin, RAJA::Index_type end) {
+    count_ptr->fetch_add(end - begin);
+  });
+  ASSERT_EQ(N, count.load());
+}
@@ -0,0 +1,122 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for VectorRegister and vector_exec
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+template <typename T>
+class VectorRegisterUnitTest : public ::testing::Test
+{
+};
+
+using VectorRegisterTypes = ::testing::Types<float, double, int, long>;
+
+TYPED_TEST_SUITE(VectorRegisterUnitTest, VectorRegisterTypes);
+
+TYPED_TEST(VectorRegisterUnitTest, Arithmetic)
+{
+  using T = TypeParam;
+  constexpr size_t W = RAJA::native_vector_width<T>::value;
+  using reg = RAJA::VectorRegister<T, W>;
+
+  T a_data[W], b_data[W];
+  for (size_t l = 0; l < W; ++l) {
+    a_data[l] = static_cast<T>(l + 1);
+    b_data[l] = static_cast<T>(2 * W - l);
+  }
+
+  reg a = reg::load(a_data);
+  reg b = reg::load(b_data);
+
+  reg sum = a + b;
+  reg prod = a * T(2);
+  reg diff = T(1) - a;
+  reg quot = b / a;
+  reg lo = RAJA::min(a, b);
+  reg hi = RAJA::max(a, b);
+  reg sel = RAJA::blend(a < b, a, b);
+
+  for (size_t l = 0; l < W; ++l) {
+    ASSERT_EQ(a_data[l] + b_data[l], sum[l]);
+    ASSERT_EQ(a_data[l] * T(2), prod[l]);
+    ASSERT_EQ(T(1) - a_data[l], diff[l]);
+    ASSERT_EQ(b_data[l] / a_data[l], quot[l]);
+    ASSERT_EQ(a_data[l] < b_data[l] ? a_data[l] : b_data[l], lo[l]);
+    ASSERT_EQ(a_data[l] < b_data[l] ? b_data[l] : a_data[l], hi[l]);
+    ASSERT_EQ(lo[l], sel[l]);
+  }
+
+  ASSERT_EQ(T(W * (W + 1) / 2), a.sum());
+  ASSERT_EQ(T(1), a.min());
+  ASSERT_EQ(T(W), a.max());
+  ASSERT_TRUE((a == a).all());
+  ASSERT_FALSE((a != a).any());
+
+  // partial loads leave the remaining lanes zero, partial stores leave the
+  // remaining elements untouched
+  T c_data[W];
+  for (size_t l = 0; l < W; ++l) {
+    c_data[l] = T(-1);
+  }
+  reg part = reg::load(a_data, W / 2);
+  part.store(c_data, W / 2);
+  for (size_t l = 0; l < W; ++l) {
+    ASSERT_EQ(l < W / 2 ? a_data[l] : T(0), part[l]);
+    ASSERT_EQ(l < W / 2 ? a_data[l] : T(-1), c_data[l]);
+  }
+}
+
+TEST(VectorExecUnitTest, ForallView)
+{
+  constexpr size_t W = RAJA::native_vector_width<double>::value;
+  const int N = 37;
+  const int M = 3;
+
+  std::vector<double> x(N * M), y(N * M, 0.0), ymax(N * M, -1.0);
+  for (int k = 0; k < N * M; ++k) {
+    x[k] = (k % 7) - 3.0;
+  }
+
+  RAJA::View<const double, RAJA::Layout<2>> X(x.data(), N, M);
+  RAJA::View<double, RAJA::Layout<2>> Y(y.data(), N, M);
+  RAJA::View<const double, RAJA::Layout<1>> X1(x.data(), N * M);
+  RAJA::View<double, RAJA::Layout<1>> Ymax(ymax.data(), N * M);
+
+  using reg = RAJA::VectorRegister<double, W>;
+  double total = 0.0;
+  for (int j = 0; j < M; ++j) {
+    // X(i, j) walks a column, so lanes are M elements apart
+    RAJA::forall<RAJA::vector_exec<W>>(
+        RAJA::RangeSegment(0, N),
+        [&](RAJA::VectorIndex<RAJA::Index_type, W> i) {
+          auto xv = X(i, j).load();
+          Y(i, j) = RAJA::blend(xv < 0.0, -xv, xv) + 1.0;
+          Y(i, j) *= 2.0;
+          total += RAJA::blend(i.mask<double>(), xv, reg(0.0)).sum();
+        });
+  }
+
+  // contiguous access with a partial last pack
+  RAJA::forall<RAJA::vector_exec<W>>(
+      RAJA::RangeSegment(0, N * M),
+      [=](RAJA::VectorIndex<RAJA::Index_type, W> i) {
+        Ymax(i) = RAJA::max(X1(i).load(), reg(0.0));
+      });
+
+  double ref_total = 0.0;
+  for (int k = 0; k < N * M; ++k) {
+    ASSERT_EQ(2.0 * ((x[k] < 0.0 ? -x[k] : x[k]) + 1.0), y[k]);
+    ASSERT_EQ(x[k] < 0.0 ? 0.0 : x[k], ymax[k]);
+    ref_total += x[k];
+  }
+  ASSERT_EQ(ref_total, total);
+}
@@ -0,0 +1,83 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_unit-test-types.hpp"
+
+#include <vector>
+
+template<typename T>
+class StreamingViewUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(StreamingViewUnitTest, UnitIntFloatTypes);
+
+template <typename T, typename ExecPolicy>
+void StreamingTriadTest(int N)
+{
+  std::vector<T> a(N, T(0)), b(N), c(N);
+  for (int i = 0; i < N; ++i) {
+    b[i] = static_cast<T>(i % 50);
+    c[i] = static_cast<T>(i % 7);
+  }
+
+  RAJA::StreamingView<T, RAJA::Layout<1>> a_view(a.data(), N);
+  const T* b_ptr = b.data();
+  const T* c_ptr = c.data();
+
+  RAJA::forall<RAJA::streaming_exec<ExecPolicy>>(
+      RAJA::RangeSegment(0, N),
+      [=](int i) { a_view(i) = b_ptr[i] + T(2) * c_ptr[i]; });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(static_cast<T>(b[i] + T(2) * c[i]), a[i]);
+  }
+}
+
+TYPED_TEST(StreamingViewUnitTest, Accessor)
+{
+  const int Nx = 3;
+  const int Ny = 5;
+  std::vector<TypeParam> a(Nx * Ny, TypeParam(0));
+
+  RAJA::StreamingView<TypeParam, RAJA::Layout<2>> view(a.data(), Nx, Ny);
+  for (int i = 0; i < Nx; ++i) {
+    for (int j = 0; j < Ny; ++j) {
+      view(i, j) = static_cast<TypeParam>(i * Ny + j);
+    }
+  }
+  RAJA::streaming_fence();
+
+  for (int i = 0; i < Nx; ++i) {
+    for (int j = 0; j < Ny; ++j) {
+      ASSERT_EQ(static_cast<TypeParam>(i * Ny + j), a[i * Ny + j]);
+      ASSERT_EQ(a[i * Ny + j], static_cast<TypeParam>(view(i, j)));
+    }
+  }
+
+  // element to element assignment copies the value, not the reference
+  view(0, 0) = view(2, 4);
+  RAJA::streaming_fence();
+  ASSERT_EQ(static_cast<TypeParam>(2 * Ny + 4), a[0]);
+
+  // shifted views keep streaming stores
+  auto shifted = view.shift({{1, 1}});
+  shifted(1, 1) = TypeParam(3);
+  RAJA::streaming_fence();
+  ASSERT_EQ(TypeParam(3), a[0]);
+}
+
+TYPED_TEST(StreamingViewUnitTest, Forall)
+{
+  StreamingTriadTest<TypeParam, RAJA::seq_exec>(1000);
+  StreamingTriadTest<TypeParam, RAJA::loop_exec>(1001);
+#if defined(RAJA_ENABLE_OPENMP)
+  StreamingTriadTest<TypeParam, RAJA::omp_parallel_for_exec>(10000);
+#endif
+#if defined(RAJA_ENABLE_TBB)
+  StreamingTriadTest<TypeParam, RAJA::tbb_for_dynamic>(10000);
+#endif
+}